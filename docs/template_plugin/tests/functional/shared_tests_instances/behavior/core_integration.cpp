@@ -107,6 +107,57 @@ TEST_F(IEClassSetConfigTestHETERO, smoke_SetConfigNoThrow) {
     }
 }
 
+TEST_F(IEClassSetConfigTestHETERO, smoke_SetConfigPipelined) {
+    Core ie;
+    Parameter p;
+
+    ASSERT_NO_THROW(p = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(PIPELINED)));
+    ASSERT_FALSE(p.as<bool>());
+
+    ASSERT_NO_THROW(ie.SetConfig({{HETERO_CONFIG_KEY(PIPELINED), CONFIG_VALUE(YES)}}, "HETERO"));
+    ASSERT_NO_THROW(p = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(PIPELINED)));
+    ASSERT_TRUE(p.as<bool>());
+}
+
+using IEClassLoadNetworkTestHETERO = IEClassNetworkTest;
+
+TEST_F(IEClassLoadNetworkTestHETERO, smoke_PipelinedDisablesExclusiveAsyncRequests) {
+    Core ie;
+    ExecutableNetwork exeNetwork;
+    ASSERT_NO_THROW(exeNetwork = ie.LoadNetwork(simpleNetwork, "HETERO:" + std::string(CommonTestUtils::DEVICE_TEMPLATE),
+        {{HETERO_CONFIG_KEY(PIPELINED), CONFIG_VALUE(YES)}}));
+    ASSERT_FALSE(exeNetwork.GetConfig(CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)).as<bool>());
+}
+
+TEST_F(IEClassLoadNetworkTestHETERO, smoke_PipelinedThrowsWithExclusiveAsyncRequests) {
+    Core ie;
+    ASSERT_THROW(ie.LoadNetwork(simpleNetwork, "HETERO:" + std::string(CommonTestUtils::DEVICE_TEMPLATE),
+        {{HETERO_CONFIG_KEY(PIPELINED), CONFIG_VALUE(YES)},
+         {CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS), CONFIG_VALUE(YES)}}),
+        InferenceEngine::details::InferenceEngineException);
+}
+
+using IEClassLoadNetworkTestMULTI = IEClassNetworkTest;
+
+TEST_F(IEClassLoadNetworkTestMULTI, smoke_EarliestCompletionSchedulingPolicyReportsDeviceMetrics) {
+    Core ie;
+    ExecutableNetwork exeNetwork;
+    ASSERT_NO_THROW(exeNetwork = ie.LoadNetwork(simpleNetwork, "MULTI:" + std::string(CommonTestUtils::DEVICE_TEMPLATE),
+        {{MULTI_CONFIG_KEY(SCHEDULING_POLICY), MULTI_CONFIG_VALUE(EARLIEST_COMPLETION)}}));
+    ASSERT_EQ(exeNetwork.GetConfig(MULTI_CONFIG_KEY(SCHEDULING_POLICY)).as<std::string>(),
+              std::string{MULTI_CONFIG_VALUE(EARLIEST_COMPLETION)});
+
+    auto request = exeNetwork.CreateInferRequest();
+    ASSERT_NO_THROW(request.Infer());
+
+    using DeviceValues = std::map<std::string, float>;
+    DeviceValues throughput, latency;
+    ASSERT_NO_THROW(throughput = exeNetwork.GetMetric(MULTI_METRIC_KEY(DEVICE_THROUGHPUT)).as<DeviceValues>());
+    ASSERT_NO_THROW(latency = exeNetwork.GetMetric(MULTI_METRIC_KEY(DEVICE_LATENCY)).as<DeviceValues>());
+    ASSERT_EQ(1, throughput.count(CommonTestUtils::DEVICE_TEMPLATE));
+    ASSERT_GT(latency.at(CommonTestUtils::DEVICE_TEMPLATE), 0.f);
+}
+
 //
 // IE Class GetConfig
 //
@@ -52,6 +52,7 @@ typedef struct ie_core ie_core_t;
 typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
+typedef struct ie_infer_requests_queue ie_infer_requests_queue_t;
 typedef struct ie_blob ie_blob_t;
 
 /**
@@ -219,7 +220,9 @@ typedef enum {
 typedef enum {
     NO_RESIZE = 0,    //!< "No resize" mode
     RESIZE_BILINEAR,  //!< "Bilinear resize" mode
-    RESIZE_AREA       //!< "Area resize" mode
+    RESIZE_AREA,      //!< "Area resize" mode
+    RESIZE_NEAREST,   //!< "Nearest neighbor resize" mode
+    RESIZE_BICUBIC    //!< "Bicubic resize" mode
 } resize_alg_e;
 
 /**
@@ -295,6 +298,16 @@ typedef struct ie_complete_call_back {
     void *args;
 } ie_complete_call_back_t;
 
+/**
+ * @struct ie_queue_call_back
+ * @brief Completion callback of a job started in the infer requests queue, it gets the infer request
+ * which ran the job, status of the inference and args
+ */
+typedef struct ie_queue_call_back {
+    void (INFERENCE_ENGINE_C_API_CALLBACK *completeCallBackFunc)(ie_infer_request_t *infer_request, IEStatusCode status, void *args);
+    void *args;
+} ie_queue_call_back_t;
+
 /**
  * @struct ie_available_devices
  * @brief Represent all available devices.
@@ -644,6 +657,82 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_batch(ie_
 
 /** @} */ // end of InferRequest
 
+// InferRequestsQueue
+
+/**
+ * @defgroup InferRequestsQueue InferRequestsQueue
+ * Set of functions running asynchronous inference jobs on a pool of infer requests
+ * of certain ExecutableNetwork.
+ * @{
+ */
+
+/**
+ * @brief Creates a pool of infer requests of the executable network. Idle requests tracking is done
+ * by the queue, so jobs can be started from any thread. Use the ie_infer_requests_queue_free() method to free memory.
+ * @ingroup InferRequestsQueue
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param num_requests A number of infer requests in the pool. If 0, the optimal number of infer requests
+ * reported by the plugin is used.
+ * @param queue A pointer to the newly created ie_infer_requests_queue_t instance.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_create_infer_requests_queue(ie_executable_network_t *ie_exec_network, \
+        const size_t num_requests, ie_infer_requests_queue_t **queue);
+
+/**
+ * @brief Waits for all running jobs and releases memory occupied by ie_infer_requests_queue_t instance.
+ * @ingroup InferRequestsQueue
+ * @param queue A pointer to the ie_infer_requests_queue_t to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_infer_requests_queue_free(ie_infer_requests_queue_t **queue);
+
+/**
+ * @brief Takes an idle infer request from the queue to fill its inputs. The request belongs to the queue,
+ * it must not be freed and its completion callback must not be changed. The request is given back
+ * with ie_infer_requests_queue_start_async() or ie_infer_requests_queue_release_request().
+ * @ingroup InferRequestsQueue
+ * @param queue A pointer to ie_infer_requests_queue_t instance.
+ * @param timeout Maximum duration in milliseconds to block for, -1 waits until some infer request becomes idle.
+ * @param infer_request A pointer to the idle infer request.
+ * @return Status code of the operation: OK(0) for success, RESULT_NOT_READY if no request became idle in time.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_requests_queue_get_idle_request(ie_infer_requests_queue_t *queue, \
+        const int64_t timeout, ie_infer_request_t **infer_request);
+
+/**
+ * @brief Starts asynchronous inference of the infer request taken from the queue. The request becomes idle
+ * again after the callback returns.
+ * @ingroup InferRequestsQueue
+ * @param queue A pointer to ie_infer_requests_queue_t instance.
+ * @param infer_request An infer request taken by ie_infer_requests_queue_get_idle_request().
+ * @param callback A callback of the job called from an inference thread, can be NULL.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_requests_queue_start_async(ie_infer_requests_queue_t *queue, \
+        ie_infer_request_t *infer_request, const ie_queue_call_back_t *callback);
+
+/**
+ * @brief Gives an infer request taken from the queue back without running inference.
+ * @ingroup InferRequestsQueue
+ * @param queue A pointer to ie_infer_requests_queue_t instance.
+ * @param infer_request An infer request taken by ie_infer_requests_queue_get_idle_request().
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_requests_queue_release_request(ie_infer_requests_queue_t *queue, \
+        ie_infer_request_t *infer_request);
+
+/**
+ * @brief Waits until all infer requests of the queue are idle, i.e. all started jobs are finished
+ * and their callbacks returned.
+ * @ingroup InferRequestsQueue
+ * @param queue A pointer to ie_infer_requests_queue_t instance.
+ * @param timeout Maximum duration in milliseconds to block for, -1 waits without a limit.
+ * @return Status code of the operation: OK(0) for success, RESULT_NOT_READY if jobs are still running.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_requests_queue_wait_all(ie_infer_requests_queue_t *queue, const int64_t timeout);
+
+/** @} */ // end of InferRequestsQueue
+
 // Network
 
 /**
@@ -14,6 +14,9 @@
 #include <chrono>
 #include <tuple>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "details/ie_exception.hpp"
@@ -46,6 +49,44 @@ struct ie_infer_request {
     IE::InferRequest object;
 };
 
+/**
+ * @struct ie_infer_requests_queue
+ * @brief This struct represents a pool of infer requests of an executable network
+ */
+struct ie_infer_requests_queue {
+    std::vector<std::unique_ptr<ie_infer_request_t>> requests;
+    std::vector<ie_queue_call_back_t> callbacks;
+    std::vector<size_t> idle_ids;
+    std::mutex mutex;
+    std::condition_variable idle_cv;
+
+    size_t index_of(const ie_infer_request_t *request) const {
+        for (size_t i = 0; i < requests.size(); ++i) {
+            if (requests[i].get() == request) {
+                return i;
+            }
+        }
+        return requests.size();
+    }
+
+    void set_idle(size_t index) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (std::find(idle_ids.begin(), idle_ids.end(), index) == idle_ids.end()) {
+            idle_ids.push_back(index);
+        }
+        idle_cv.notify_all();
+    }
+
+    template <class Predicate>
+    bool wait_for(int64_t timeout, std::unique_lock<std::mutex>& lock, Predicate pred) {
+        if (timeout < 0) {
+            idle_cv.wait(lock, pred);
+            return true;
+        }
+        return idle_cv.wait_for(lock, std::chrono::milliseconds(timeout), pred);
+    }
+};
+
 /**
  * @struct ie_blob
  * @brief This struct represents a universal container in the Inference Engine
@@ -109,7 +150,9 @@ std::map<IE::Layout, layout_e> layout_map = {{IE::Layout::ANY, layout_e::ANY},
 
 std::map<IE::ResizeAlgorithm, resize_alg_e> resize_alg_map = {{IE::ResizeAlgorithm::NO_RESIZE, resize_alg_e::NO_RESIZE},
                                                                 {IE::ResizeAlgorithm::RESIZE_AREA, resize_alg_e::RESIZE_AREA},
-                                                                {IE::ResizeAlgorithm::RESIZE_BILINEAR, resize_alg_e::RESIZE_BILINEAR}};
+                                                                {IE::ResizeAlgorithm::RESIZE_BILINEAR, resize_alg_e::RESIZE_BILINEAR},
+                                                                {IE::ResizeAlgorithm::RESIZE_NEAREST, resize_alg_e::RESIZE_NEAREST},
+                                                                {IE::ResizeAlgorithm::RESIZE_BICUBIC, resize_alg_e::RESIZE_BICUBIC}};
 
 std::map<IE::ColorFormat, colorformat_e> colorformat_map = {{IE::ColorFormat::RAW, colorformat_e::RAW},
                                                             {IE::ColorFormat::RGB, colorformat_e::RGB},
@@ -1385,6 +1428,129 @@ IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_exec_network_create_infer_requests_queue(ie_executable_network_t *ie_exec_network, const size_t num_requests,
+                                                       ie_infer_requests_queue_t **queue) {
+    if (ie_exec_network == nullptr || queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        size_t size = num_requests;
+        if (size == 0) {
+            size = ie_exec_network->object.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        }
+
+        std::unique_ptr<ie_infer_requests_queue_t> queue_result(new ie_infer_requests_queue_t);
+        auto queue_ptr = queue_result.get();
+        queue_ptr->callbacks.resize(size, ie_queue_call_back_t{nullptr, nullptr});
+        for (size_t i = 0; i < size; ++i) {
+            std::unique_ptr<ie_infer_request_t> req(new ie_infer_request_t);
+            req->object = ie_exec_network->object.CreateInferRequest();
+            // the request is given back to the queue only after the job callback has read its outputs
+            std::function<void(IE::InferRequest, IE::StatusCode)> callback = [queue_ptr, i](IE::InferRequest, IE::StatusCode code) {
+                const ie_queue_call_back_t job_callback = queue_ptr->callbacks[i];
+                if (job_callback.completeCallBackFunc) {
+                    auto status = status_map.find(code);
+                    job_callback.completeCallBackFunc(queue_ptr->requests[i].get(),
+                                                      status != status_map.end() ? status->second : IEStatusCode::UNEXPECTED,
+                                                      job_callback.args);
+                }
+                queue_ptr->set_idle(i);
+            };
+            req->object.SetCompletionCallback(callback);
+            queue_ptr->requests.push_back(std::move(req));
+            queue_ptr->idle_ids.push_back(i);
+        }
+        *queue = queue_result.release();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_infer_requests_queue_free(ie_infer_requests_queue_t **queue) {
+    if (queue && *queue) {
+        {
+            std::unique_lock<std::mutex> lock((*queue)->mutex);
+            auto queue_ptr = *queue;
+            queue_ptr->wait_for(-1, lock, [queue_ptr] { return queue_ptr->idle_ids.size() == queue_ptr->requests.size(); });
+        }
+        delete *queue;
+        *queue = NULL;
+    }
+}
+
+IEStatusCode ie_infer_requests_queue_get_idle_request(ie_infer_requests_queue_t *queue, const int64_t timeout,
+                                                   ie_infer_request_t **infer_request) {
+    if (queue == nullptr || infer_request == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!queue->wait_for(timeout, lock, [queue] { return !queue->idle_ids.empty(); })) {
+        return IEStatusCode::RESULT_NOT_READY;
+    }
+    // the most recently finished request is taken first as its memory is most likely still in cache
+    size_t index = queue->idle_ids.back();
+    queue->idle_ids.pop_back();
+    *infer_request = queue->requests[index].get();
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_requests_queue_start_async(ie_infer_requests_queue_t *queue, ie_infer_request_t *infer_request,
+                                              const ie_queue_call_back_t *callback) {
+    if (queue == nullptr || infer_request == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+    size_t index = queue->index_of(infer_request);
+    if (index == queue->requests.size()) {
+        return IEStatusCode::NOT_FOUND;
+    }
+
+    queue->callbacks[index] = callback ? *callback : ie_queue_call_back_t{nullptr, nullptr};
+    try {
+        infer_request->object.StartAsync();
+    } catch (const IE::details::InferenceEngineException& e) {
+        queue->set_idle(index);
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        queue->set_idle(index);
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_requests_queue_release_request(ie_infer_requests_queue_t *queue, ie_infer_request_t *infer_request) {
+    if (queue == nullptr || infer_request == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+    size_t index = queue->index_of(infer_request);
+    if (index == queue->requests.size()) {
+        return IEStatusCode::NOT_FOUND;
+    }
+
+    queue->set_idle(index);
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_requests_queue_wait_all(ie_infer_requests_queue_t *queue, const int64_t timeout) {
+    if (queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!queue->wait_for(timeout, lock, [queue] { return queue->idle_ids.size() == queue->requests.size(); })) {
+        return IEStatusCode::RESULT_NOT_READY;
+    }
+
+    return IEStatusCode::OK;
+}
+
 IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
     if (tensorDesc == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
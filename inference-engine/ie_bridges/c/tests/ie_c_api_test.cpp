@@ -1499,6 +1499,81 @@ TEST(ie_infer_set_completion_callback, setCallback) {
     ie_core_free(&core);
 }
 
+void queue_callback(ie_infer_request_t *infer_request, IEStatusCode status, void *args) {
+    EXPECT_EQ(IEStatusCode::OK, status);
+    ie_blob_t *output_blob = nullptr;
+    IE_EXPECT_OK(ie_infer_request_get_blob(infer_request, "fc_out", &output_blob));
+
+    ie_blob_buffer_t buffer;
+    IE_EXPECT_OK(ie_blob_get_buffer(output_blob, &buffer));
+    float *output_data = (float *)(buffer.buffer);
+    EXPECT_NEAR(output_data[9], 0.f, 1.e-5);
+
+    ie_blob_free(&output_blob);
+
+    std::lock_guard<std::mutex> lock(m);
+    ++*(int *)args;
+}
+
+TEST(ie_infer_requests_queue, startAsyncWaitAll) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    IE_EXPECT_OK(ie_network_set_input_precision(network, "data", precision_e::U8));
+
+    const char *device_name = "CPU";
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, device_name, &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    ie_infer_requests_queue_t *queue = nullptr;
+    IE_ASSERT_OK(ie_exec_network_create_infer_requests_queue(exe_network, 2, &queue));
+    ASSERT_NE(nullptr, queue);
+
+    cv::Mat image = cv::imread(input_image);
+    int finished_jobs = 0;
+    ie_queue_call_back_t callback;
+    callback.completeCallBackFunc = queue_callback;
+    callback.args = &finished_jobs;
+
+    const int num_jobs = 5;
+    for (int i = 0; i < num_jobs; ++i) {
+        ie_infer_request_t *infer_request = nullptr;
+        IE_ASSERT_OK(ie_infer_requests_queue_get_idle_request(queue, -1, &infer_request));
+        ASSERT_NE(nullptr, infer_request);
+
+        ie_blob_t *blob = nullptr;
+        IE_EXPECT_OK(ie_infer_request_get_blob(infer_request, "data", &blob));
+        Mat2Blob(image, blob);
+        ie_blob_free(&blob);
+
+        IE_EXPECT_OK(ie_infer_requests_queue_start_async(queue, infer_request, &callback));
+    }
+
+    IE_EXPECT_OK(ie_infer_requests_queue_wait_all(queue, -1));
+    {
+        std::lock_guard<std::mutex> lock(m);
+        EXPECT_EQ(num_jobs, finished_jobs);
+    }
+
+    ie_infer_request_t *infer_request = nullptr;
+    IE_EXPECT_OK(ie_infer_requests_queue_get_idle_request(queue, 0, &infer_request));
+    IE_EXPECT_OK(ie_infer_requests_queue_release_request(queue, infer_request));
+    IE_EXPECT_OK(ie_infer_requests_queue_wait_all(queue, 0));
+
+    ie_infer_requests_queue_free(&queue);
+    EXPECT_EQ(nullptr, queue);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
 TEST(ie_blob_make_memory_nv12, makeNV12Blob) {
     dimensions_t dim_y = {4, {1, 1, 8, 12}}, dim_uv = {4, {1, 2, 4, 6}};
     tensor_desc tensor_y, tensor_uv;
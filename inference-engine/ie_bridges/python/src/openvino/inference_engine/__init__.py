@@ -11,6 +11,6 @@ if sys.platform == "win32":
     os.environ["PATH"] = os.path.abspath(openvino_dll) + ";" + os.environ["PATH"]
 
 from .ie_api import *
-__all__ = ['IENetwork', "TensorDesc", "IECore", "Blob", "PreProcessInfo", "get_version"]
+__all__ = ['IENetwork', "TensorDesc", "IECore", "Blob", "PreProcessInfo", "InferRequestsQueue", "get_version"]
 __version__ = get_version()
 
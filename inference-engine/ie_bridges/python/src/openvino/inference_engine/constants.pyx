@@ -67,6 +67,8 @@ class ResizeAlgorithm(Enum):
     NO_RESIZE = 0
     RESIZE_BILINEAR = 1
     RESIZE_AREA = 2
+    RESIZE_NEAREST = 3
+    RESIZE_BICUBIC = 4
 
 
 class ColorFormat(Enum):
@@ -29,13 +29,13 @@ cdef class InferRequest:
 
     cpdef BlobBuffer _get_blob_buffer(self, const string & blob_name)
 
-    cpdef infer(self, inputs = ?)
-    cpdef async_infer(self, inputs = ?)
+    cpdef infer(self, inputs = ?, share_inputs = ?)
+    cpdef async_infer(self, inputs = ?, share_inputs = ?)
     cpdef wait(self, timeout = ?)
     cpdef get_perf_counts(self)
     cdef void user_callback(self, int status) with gil
     cdef public:
-        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called, _user_blobs
+        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called, _user_blobs, _shared_inputs
 
 cdef class IENetwork:
     cdef C.IENetwork impl
@@ -48,6 +48,12 @@ cdef class ExecutableNetwork:
     cdef public:
         _requests, _infer_requests
 
+cdef class InferRequestsQueue:
+    cdef unique_ptr[C.InferRequestsQueue] impl
+    cdef void _on_complete(self, int index, int status) with gil
+    cdef public:
+        _network, _requests, _userdata, _callback
+
 cdef class IECore:
     cdef C.IECore impl
     cpdef IENetwork read_network(self, model : [str, bytes, os.PathLike], weights : [str, bytes, os.PathLike] = ?, bool init_from_buffer = ?)
@@ -767,6 +767,10 @@ cdef class ExecutableNetwork:
     #  Wraps `infer()` method of the `InferRequest` class
     #  @param inputs:  A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                  input data for the layer
+    #  @param share_inputs: If `True`, C-contiguous input arrays of matching shape and precision are bound to
+    #                       the infer request without copying. See `infer()` method of the `InferRequest` class.
+    #  @param share_outputs: If `True`, returned arrays are views of the infer request output memory instead of
+    #                        copies. The views are valid until the next inference of the first infer request.
     #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer
     #
     #  Usage example:\n
@@ -783,12 +787,13 @@ cdef class ExecutableNetwork:
     #                  ......
     #                 ]])}
     #  ```
-    def infer(self, inputs=None):
+    def infer(self, inputs=None, share_inputs=False, share_outputs=False):
         current_request = self.requests[0]
-        current_request.infer(inputs)
+        current_request.infer(inputs, share_inputs)
         res = {}
-        for name, value in current_request.output_blobs.items():
-            res[name] = deepcopy(value.buffer)
+        for name in current_request._outputs_list:
+            buffer = current_request._get_blob_buffer(name.encode()).to_numpy()
+            res[name] = buffer if share_outputs else buffer.copy()
         return res
 
 
@@ -934,11 +939,18 @@ cdef class ExecutableNetwork:
     #                  If not specified, `timeout` value is set to -1 by default.
     #  @return Request status code: OK or RESULT_NOT_READY
     cpdef wait(self, num_requests=None, timeout=None):
+        cdef int c_num_requests
+        cdef int64_t c_timeout
+        cdef int status
         if num_requests is None:
             num_requests = len(self.requests)
         if timeout is None:
             timeout = WaitMode.RESULT_READY
-        return deref(self.impl).wait(<int> num_requests, <int64_t> timeout)
+        c_num_requests = <int> num_requests
+        c_timeout = <int64_t> timeout
+        with nogil:
+            status = deref(self.impl).wait(c_num_requests, c_timeout)
+        return status
 
     ## Get idle request ID
     #  @return Request index
@@ -946,6 +958,7 @@ cdef class ExecutableNetwork:
         return deref(self.impl).getIdleRequestId()
 
 ctypedef extern void (*cb_type)(void*, int) with gil
+ctypedef extern void (*queue_cb_type)(void*, int, int) with gil
 
 ## This class provides an interface to infer requests of `ExecutableNetwork` and serves to handle infer requests execution
 #  and to set and get output data.
@@ -955,6 +968,7 @@ cdef class InferRequest:
     #  which stores infer requests.
     def __init__(self):
         self._user_blobs = {}
+        self._shared_inputs = {}
         self._inputs_list = []
         self._outputs_list = []
         self._py_callback = lambda *args, **kwargs: None
@@ -1059,10 +1073,17 @@ cdef class InferRequest:
         else:
             deref(self.impl).setBlob(blob_name.encode(), blob._ptr)
         self._user_blobs[blob_name] = blob
+        self._shared_inputs.pop(blob_name, None)
+
     ## Starts synchronous inference of the infer request and fill outputs array
     #
+    #  \note The Python GIL is released while the inference runs, so other Python threads are not blocked.
+    #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                 input data for the layer
+    #  @param share_inputs: If `True`, C-contiguous arrays whose shape and dtype match the input blob are bound to
+    #                       the infer request as blobs over the array memory instead of being copied. Such arrays
+    #                       must not be modified until the inference is finished. Other arrays are copied.
     #  @return None
     #
     #  Usage example:\n
@@ -1075,15 +1096,18 @@ cdef class InferRequest:
     #         5.45198545e-02, 2.44456064e-02, 5.41366823e-03, 3.42589128e-03,
     #         2.26027006e-03, 2.12283316e-03 ...])
     #  ```
-    cpdef infer(self, inputs=None):
+    cpdef infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, share_inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            deref(self.impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with input data for the layer
+    #  @param share_inputs: If `True`, suitable arrays are bound without copying, see `infer()` method.
+    #                       Such arrays must not be modified until `wait()` returns.
     #  @return: None
     #
     #  Usage example:\n
@@ -1093,12 +1117,13 @@ cdef class InferRequest:
     #  request_status = exec_net.requests[0].wait()
     #  res = exec_net.requests[0].output_blobs['prob']
     #  ```
-    cpdef async_infer(self, inputs=None):
+    cpdef async_infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, share_inputs)
         if self._py_callback_used:
             self._py_callback_called.clear()
-        deref(self.impl).infer_async()
+        with nogil:
+            deref(self.impl).infer_async()
 
     ## Waits for the result to become available. Blocks until specified timeout elapses or the result
     #  becomes available, whichever comes first.
@@ -1114,9 +1139,13 @@ cdef class InferRequest:
     #
     #  Usage example: See `async_infer()` method of the the `InferRequest` class.
     cpdef wait(self, timeout=None):
+        cdef int64_t c_timeout
+        cdef int status
         if self._py_callback_used:
             # check request status to avoid blocking for idle requests
-            status = deref(self.impl).wait(WaitMode.STATUS_ONLY)
+            c_timeout = WaitMode.STATUS_ONLY
+            with nogil:
+                status = deref(self.impl).wait(c_timeout)
             if status != StatusCode.RESULT_NOT_READY:
                 return status
             if not self._py_callback_called.is_set():
@@ -1132,7 +1161,10 @@ cdef class InferRequest:
         if timeout is None:
             timeout = WaitMode.RESULT_READY
 
-        return deref(self.impl).wait(<int64_t> timeout)
+        c_timeout = <int64_t> timeout
+        with nogil:
+            status = deref(self.impl).wait(c_timeout)
+        return status
 
     ## Queries performance measures per layer to get feedback of what is the most time consuming layer.
     #
@@ -1220,13 +1252,152 @@ cdef class InferRequest:
             raise ValueError(f"Batch size should be positive integer number but {size} specified")
         deref(self.impl).setBatch(size)
 
-    def _fill_inputs(self, inputs):
+    def _get_input_blob(self, name):
+        if name in self._user_blobs:
+            return self._user_blobs[name]
+        cdef Blob blob = Blob()
+        deref(self.impl).getBlobPtr(name.encode(), blob._ptr)
+        return blob
+
+    def _share_input(self, name, array, Blob blob):
+        if self._shared_inputs.get(name) is array:
+            return True
+        tensor_desc = blob.tensor_desc
+        if not isinstance(array, np.ndarray) or not array.flags['C_CONTIGUOUS'] or \
+                array.dtype != format_map.get(tensor_desc.precision) or tuple(array.shape) != tuple(tensor_desc.dims):
+            return False
+        self.set_blob(name, Blob(tensor_desc, array))
+        self._shared_inputs[name] = array
+        return True
+
+    def _fill_inputs(self, inputs, share_inputs=False):
         for k, v in inputs.items():
             assert k in self._inputs_list, f"No input with name {k} found in network"
-            if self.input_blobs[k].tensor_desc.precision == "FP16":
-                self.input_blobs[k].buffer[:] = v.view(dtype=np.int16)
+            blob = self._get_input_blob(k)
+            if share_inputs and self._share_input(k, v, blob):
+                continue
+            if k in self._shared_inputs:
+                # array bound by a previous call belongs to the user, so copy into a blob of our own
+                blob = Blob(blob.tensor_desc)
+                self.set_blob(k, blob)
+            if blob.tensor_desc.precision == "FP16":
+                blob.buffer[:] = v.view(dtype=np.int16)
             else:
-                self.input_blobs[k].buffer[:] = v
+                blob.buffer[:] = v
+
+
+## This class is a pool of infer requests that runs asynchronous inference jobs of an `ExecutableNetwork`.
+#  Jobs are dispatched to idle infer requests and completions are tracked in C++, so the Python interpreter
+#  is only entered to fill inputs and to run the user callback.
+#
+#  Usage example:\n
+#  ```python
+#  ie = IECore()
+#  net = ie.read_network(model=path_to_xml_file, weights=path_to_bin_file)
+#  exec_net = ie.load_network(network=net, device_name="CPU")
+#  results = {}
+#  def callback(request, status, frame_id):
+#      results[frame_id] = request.output_blobs['prob'].buffer
+#  infer_queue = InferRequestsQueue(exec_net)
+#  infer_queue.set_callback(callback)
+#  for frame_id, frame in enumerate(frames):
+#      infer_queue.start_async({'data': frame}, userdata=frame_id)
+#  infer_queue.wait_all()
+#  ```
+cdef class InferRequestsQueue:
+    ## Class constructor
+    #  @param network: `ExecutableNetwork` object to create infer requests of the pool from
+    #  @param num_requests: A number of infer requests in the pool. If 0, the optimal number of infer requests
+    #                       reported by the plugin is used.
+    #  @return Instance of InferRequestsQueue class
+    def __cinit__(self, ExecutableNetwork network, int num_requests = 0):
+        if num_requests < 0:
+            raise ValueError(f"Incorrect number of requests specified: {num_requests}. Expected positive integer number "
+                             "or zero for auto detection")
+        self.impl.reset(new C.InferRequestsQueue(deref(network.impl), num_requests))
+        self._network = network
+        self._callback = None
+        self._requests = []
+        inputs_list = list(network.input_info.keys())
+        outputs_list = list(network.outputs.keys())
+        for i in range(deref(self.impl).requests.size()):
+            infer_request = InferRequest()
+            infer_request.impl = &(deref(self.impl).requests[i])
+            infer_request._inputs_list = list(inputs_list)
+            infer_request._outputs_list = list(outputs_list)
+            self._requests.append(infer_request)
+        self._userdata = [None] * len(self._requests)
+
+    def __dealloc__(self):
+        if self.impl.get() != NULL:
+            # completion callbacks of running jobs may still need the GIL
+            with nogil:
+                deref(self.impl).waitAll(-1)
+
+    def __len__(self):
+        return len(self._requests)
+
+    cdef void _on_complete(self, int index, int status) with gil:
+        callback = self._callback
+        userdata = self._userdata[index]
+        self._userdata[index] = None
+        if callback is not None:
+            callback(self._requests[index], status, userdata)
+
+    ## A tuple of `InferRequest` instances of the pool
+    @property
+    def requests(self):
+        return tuple(self._requests)
+
+    ## Sets a callback function that is called from an inference thread when a job finishes.
+    #  The infer request is not given to other jobs until the callback returns, so it can read the outputs.
+    #
+    #  @param callback: Any function accepting the `InferRequest`, status code and `userdata` of the job
+    #                   or `None` to remove the callback
+    #  @return None
+    def set_callback(self, callback):
+        self._callback = callback
+        if callback is None:
+            deref(self.impl).setCyCallback(NULL, NULL)
+        else:
+            deref(self.impl).setCyCallback(<queue_cb_type> self._on_complete, <void *> self)
+
+    ## Starts asynchronous inference on an idle infer request of the pool.
+    #  Blocks without holding the GIL until some infer request becomes idle.
+    #
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
+    #                 input data for the layer
+    #  @param userdata: Any object passed to the callback when this job finishes
+    #  @param share_inputs: If `True`, suitable arrays are bound without copying, see `InferRequest.infer()` method.
+    #  @return Index of the infer request running the job
+    def start_async(self, inputs=None, userdata=None, share_inputs=False):
+        cdef int index
+        with nogil:
+            index = deref(self.impl).getIdleRequestId(-1)
+        try:
+            if inputs is not None:
+                self._requests[index]._fill_inputs(inputs, share_inputs)
+        except:
+            deref(self.impl).setRequestIdle(index)
+            raise
+        self._userdata[index] = userdata
+        with nogil:
+            deref(self.impl).startAsync(index)
+        return index
+
+    ## Waits until all jobs of the pool are finished and their callbacks returned.
+    #  @param timeout: Time to wait in milliseconds. If not specified or -1, waits without a limit.
+    #                  0 only checks whether all jobs are finished and returns immediately.
+    #  @return Status code: OK or RESULT_NOT_READY
+    def wait_all(self, timeout=None):
+        cdef int64_t c_timeout
+        cdef int status
+        if timeout is None:
+            timeout = WaitMode.RESULT_READY
+        c_timeout = <int64_t> timeout
+        with nogil:
+            status = deref(self.impl).waitAll(c_timeout)
+        return status
 
 
 ## This class contains the information about the network model read from IR and allows you to manipulate with
@@ -425,7 +425,9 @@ void InferenceEnginePython::InferRequestWrap::infer_async() {
 int InferenceEnginePython::InferRequestWrap::wait(int64_t timeout) {
     InferenceEngine::ResponseDesc responseDesc;
     InferenceEngine::StatusCode code = request_ptr->Wait(timeout, &responseDesc);
-    if (code != InferenceEngine::RESULT_NOT_READY) {
+    // requests of InferRequestsQueue are given back only by queue_callback, otherwise a request acquired
+    // by the queue but not started yet would be reported idle and handed out twice
+    if (code != InferenceEngine::RESULT_NOT_READY && queue_ptr == nullptr) {
         request_queue_ptr->setRequestIdle(index);
     }
     return static_cast<int>(code);
@@ -491,17 +493,22 @@ int InferenceEnginePython::IEExecNetwork::getIdleRequestId() {
 
 int InferenceEnginePython::IdleInferRequestQueue::wait(int num_requests, int64_t timeout) {
     std::unique_lock<std::mutex> lock(mutex);
-    if (timeout > 0) {
-        if (!cv.wait_for(lock, std::chrono::milliseconds(timeout), [this, num_requests](){return idle_ids.size() >= num_requests;}))
+    auto ready = [this, num_requests](){return idle_ids.size() >= num_requests;};
+    // negative timeout waits without a limit, zero only polls the current state
+    if (timeout >= 0) {
+        if (!cv.wait_for(lock, std::chrono::milliseconds(timeout), ready))
             return static_cast<int>(InferenceEngine::StatusCode::RESULT_NOT_READY);
     } else
-        cv.wait(lock, [this, num_requests](){return idle_ids.size() >= num_requests;});
+        cv.wait(lock, ready);
     return static_cast<int>(InferenceEngine::StatusCode::OK);
 }
 
 void InferenceEnginePython::IdleInferRequestQueue::setRequestIdle(int index) {
    std::unique_lock<std::mutex> lock(mutex);
-   idle_ids.emplace_back(index);
+   // both completion callback and wait() report the same request
+   if (std::find(idle_ids.begin(), idle_ids.end(), index) == idle_ids.end()) {
+       idle_ids.emplace_back(index);
+   }
    cv.notify_all();
 }
 
@@ -515,6 +522,20 @@ int InferenceEnginePython::IdleInferRequestQueue::getIdleRequestId() {
     return idle_ids.size() ? idle_ids.front() : -1;
 }
 
+int InferenceEnginePython::IdleInferRequestQueue::acquireIdleRequestId(int64_t timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto hasIdle = [this](){return !idle_ids.empty();};
+    if (timeout >= 0) {
+        if (!cv.wait_for(lock, std::chrono::milliseconds(timeout), hasIdle))
+            return -1;
+    } else {
+        cv.wait(lock, hasIdle);
+    }
+    int index = idle_ids.front();
+    idle_ids.pop_front();
+    return index;
+}
+
 void InferenceEnginePython::IEExecNetwork::createInferRequests(int num_requests) {
     if (0 == num_requests) {
         num_requests = getOptimalNumberOfRequests(actual);
@@ -532,6 +553,68 @@ void InferenceEnginePython::IEExecNetwork::createInferRequests(int num_requests)
     }
 }
 
+void queue_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
+    InferenceEnginePython::InferRequestWrap *requestWrap;
+    InferenceEngine::ResponseDesc dsc;
+    request->GetUserData(reinterpret_cast<void **>(&requestWrap), &dsc);
+    auto queue = requestWrap->queue_ptr;
+    auto end_time = Time::now();
+    auto execTime = std::chrono::duration_cast<ns>(end_time - requestWrap->start_time);
+    requestWrap->exec_time = static_cast<double>(execTime.count()) * 0.000001;
+    // request is given back only after the callback so that it can still read outputs
+    if (queue->user_callback) {
+        queue->user_callback(queue->user_data, requestWrap->index, code);
+    }
+    requestWrap->request_queue_ptr->setRequestIdle(requestWrap->index);
+}
+
+InferenceEnginePython::InferRequestsQueue::InferRequestsQueue(IEExecNetwork &network, int num_requests) {
+    if (0 == num_requests) {
+        num_requests = getOptimalNumberOfRequests(network.actual);
+    }
+    request_queue_ptr = std::make_shared<IdleInferRequestQueue>();
+    requests.resize(num_requests);
+    InferenceEngine::ResponseDesc response;
+    for (size_t i = 0; i < num_requests; ++i) {
+        InferRequestWrap &infer_request = requests[i];
+        infer_request.index = i;
+        infer_request.queue_ptr = this;
+        infer_request.request_queue_ptr = request_queue_ptr;
+        IE_CHECK_CALL(network.actual->CreateInferRequest(infer_request.request_ptr, &response))
+        IE_CHECK_CALL(infer_request.request_ptr->SetUserData(&infer_request, &response));
+        infer_request.request_ptr->SetCompletionCallback(queue_callback);
+        request_queue_ptr->setRequestIdle(i);
+    }
+}
+
+int InferenceEnginePython::InferRequestsQueue::getIdleRequestId(int64_t timeout) {
+    return request_queue_ptr->acquireIdleRequestId(timeout);
+}
+
+void InferenceEnginePython::InferRequestsQueue::setRequestIdle(int index) {
+    request_queue_ptr->setRequestIdle(index);
+}
+
+void InferenceEnginePython::InferRequestsQueue::startAsync(int index) {
+    InferRequestWrap &infer_request = requests.at(index);
+    InferenceEngine::ResponseDesc response;
+    infer_request.start_time = Time::now();
+    auto status = infer_request.request_ptr->StartAsync(&response);
+    if (status != InferenceEngine::StatusCode::OK) {
+        request_queue_ptr->setRequestIdle(index);
+        THROW_IE_EXCEPTION << response.msg;
+    }
+}
+
+int InferenceEnginePython::InferRequestsQueue::waitAll(int64_t timeout) {
+    return request_queue_ptr->wait(static_cast<int>(requests.size()), timeout);
+}
+
+void InferenceEnginePython::InferRequestsQueue::setCyCallback(cy_callback callback, void *data) {
+    user_callback = callback;
+    user_data = data;
+}
+
 InferenceEnginePython::IENetwork
 InferenceEnginePython::IECore::readNetwork(const std::string& modelPath, const std::string& binPath) {
     InferenceEngine::CNNNetwork net = actual.ReadNetwork(modelPath, binPath);
@@ -89,10 +89,14 @@ struct IdleInferRequestQueue {
 
     int getIdleRequestId();
 
+    int acquireIdleRequestId(int64_t timeout);
+
     using Ptr = std::shared_ptr<IdleInferRequestQueue>;
 };
 
 
+struct InferRequestsQueue;
+
 struct InferRequestWrap {
     int index;
     using cy_callback = void (*)(void*, int);
@@ -103,6 +107,7 @@ struct InferRequestWrap {
     cy_callback user_callback;
     void *user_data;
     IdleInferRequestQueue::Ptr  request_queue_ptr;
+    InferRequestsQueue *queue_ptr = nullptr;
 
     void infer();
 
@@ -154,6 +159,32 @@ struct IEExecNetwork {
 };
 
 
+/**
+ * @brief Pool of infer requests of an executable network. Idle requests tracking and completion
+ * handling are done in C++, so the Python callback is the only code running under the GIL.
+ */
+struct InferRequestsQueue {
+    using cy_callback = void (*)(void*, int, int);
+
+    std::vector<InferRequestWrap> requests;
+    IdleInferRequestQueue::Ptr request_queue_ptr;
+    cy_callback user_callback = nullptr;
+    void *user_data = nullptr;
+
+    InferRequestsQueue(IEExecNetwork &network, int num_requests);
+
+    int getIdleRequestId(int64_t timeout);
+
+    void setRequestIdle(int index);
+
+    void startAsync(int index);
+
+    int waitAll(int64_t timeout);
+
+    void setCyCallback(cy_callback callback, void *data);
+};
+
+
 struct IECore {
     InferenceEngine::Core actual;
     explicit IECore(const std::string & xmlConfigFile = std::string());
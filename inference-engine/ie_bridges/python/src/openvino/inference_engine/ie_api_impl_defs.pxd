@@ -151,7 +151,7 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         void exportNetwork(const string & model_file) except +
         object getMetric(const string & metric_name) except +
         object getConfig(const string & metric_name) except +
-        int wait(int num_requests, int64_t timeout)
+        int wait(int num_requests, int64_t timeout) nogil
         int getIdleRequestId()
 
     cdef cppclass IENetwork:
@@ -186,12 +186,21 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         void setBlob(const string &blob_name, const CBlob.Ptr &blob_ptr, CPreProcessInfo& info) except +
         void getPreProcess(const string& blob_name, const CPreProcessInfo** info) except +
         map[string, ProfileInfo] getPerformanceCounts() except +
-        void infer() except +
-        void infer_async() except +
-        int wait(int64_t timeout) except +
+        void infer() except + nogil
+        void infer_async() except + nogil
+        int wait(int64_t timeout) except + nogil
         void setBatch(int size) except +
         void setCyCallback(void (*)(void*, int), void *) except +
 
+    cdef cppclass InferRequestsQueue:
+        vector[InferRequestWrap] requests
+        InferRequestsQueue(IEExecNetwork & network, int num_requests) except +
+        int getIdleRequestId(int64_t timeout) nogil
+        void setRequestIdle(int index)
+        void startAsync(int index) except + nogil
+        int waitAll(int64_t timeout) nogil
+        void setCyCallback(void (*)(void*, int, int), void *) except +
+
     cdef cppclass IECore:
         IECore() except +
         IECore(const string & xml_config_file) except +
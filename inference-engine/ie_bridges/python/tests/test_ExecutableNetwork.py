@@ -55,6 +55,21 @@ def test_infer_net_from_buffer(device):
     assert np.allclose(res['fc_out'], res2['fc_out'], atol=1E-4, rtol=1E-4)
 
 
+def test_infer_share_outputs(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(model=test_net_xml, weights=test_net_bin)
+    exec_net = ie_core.load_network(net, device)
+    img = read_image()
+    res = exec_net.infer({'data': img}, share_outputs=True)
+    assert np.argmax(res['fc_out'][0]) == 2
+    assert np.shares_memory(res['fc_out'], exec_net.requests[0]._get_blob_buffer(b'fc_out').to_numpy())
+    res_copy = exec_net.infer({'data': img})
+    assert not np.shares_memory(res_copy['fc_out'], res['fc_out'])
+    assert np.allclose(res_copy['fc_out'], res['fc_out'])
+    del exec_net
+    del ie_core
+
+
 def test_infer_wrong_input_name(device):
     ie_core = ie.IECore()
     net = ie_core.read_network(model=test_net_xml, weights=test_net_bin)
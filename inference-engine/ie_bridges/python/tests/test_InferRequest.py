@@ -278,6 +278,39 @@ def test_infer_modify_outputs(device):
     del net
 
 
+def test_infer_share_inputs(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = np.ascontiguousarray(read_image())
+    request = exec_net.requests[0]
+    request.infer({'data': img}, share_inputs=True)
+    assert np.argmax(request.output_blobs['fc_out'].buffer) == 2
+    assert np.shares_memory(request.input_blobs['data'].buffer, img)
+    request.infer({'data': np.zeros(img.shape, dtype=np.float32)})
+    assert not np.shares_memory(request.input_blobs['data'].buffer, img)
+    assert np.argmax(img) == np.argmax(read_image())
+    del exec_net
+    del ie_core
+    del net
+
+
+def test_async_infer_share_inputs_non_contiguous(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = np.asfortranarray(read_image())
+    request = exec_net.requests[0]
+    request.async_infer({'data': img}, share_inputs=True)
+    status = request.wait()
+    assert status == ie.StatusCode.OK
+    assert np.argmax(request.output_blobs['fc_out'].buffer) == 2
+    assert not np.shares_memory(request.input_blobs['data'].buffer, img)
+    del exec_net
+    del ie_core
+    del net
+
+
 def test_async_infer_callback(device):
     def static_vars(**kwargs):
         def decorate(func):
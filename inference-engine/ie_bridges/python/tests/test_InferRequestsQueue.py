@@ -0,0 +1,140 @@
+import numpy as np
+import os
+import pytest
+import threading
+
+from openvino.inference_engine import ie_api as ie
+from conftest import model_path, image_path
+
+is_myriad = os.environ.get("TEST_DEVICE") == "MYRIAD"
+test_net_xml, test_net_bin = model_path(is_myriad)
+path_to_img = image_path()
+
+
+def read_image():
+    import cv2
+    n, c, h, w = (1, 3, 32, 32)
+    image = cv2.imread(path_to_img)
+    if image is None:
+        raise FileNotFoundError("Input image not found")
+
+    image = cv2.resize(image, (h, w)) / 255
+    image = image.transpose((2, 0, 1)).astype(np.float32)
+    image = image.reshape((n, c, h, w))
+    return image
+
+
+def load_sample_model(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    return ie_core.load_network(net, device, num_requests=1)
+
+
+def test_create_queue(device):
+    exec_net = load_sample_model(device)
+    infer_queue = ie.InferRequestsQueue(exec_net, num_requests=3)
+    assert len(infer_queue) == 3
+    assert all(isinstance(request, ie.InferRequest) for request in infer_queue.requests)
+    del infer_queue
+    del exec_net
+
+
+def test_create_queue_negative_requests(device):
+    exec_net = load_sample_model(device)
+    with pytest.raises(ValueError) as e:
+        ie.InferRequestsQueue(exec_net, num_requests=-1)
+    assert "Incorrect number of requests specified: -1" in str(e.value)
+    del exec_net
+
+
+def test_start_async_callback(device):
+    exec_net = load_sample_model(device)
+    infer_queue = ie.InferRequestsQueue(exec_net, num_requests=2)
+    img = read_image()
+    results = {}
+    lock = threading.Lock()
+
+    def callback(request, status, job_id):
+        with lock:
+            results[job_id] = (status, np.argmax(request.output_blobs['fc_out'].buffer))
+
+    infer_queue.set_callback(callback)
+    num_jobs = 6
+    for job_id in range(num_jobs):
+        index = infer_queue.start_async({'data': img}, userdata=job_id)
+        assert 0 <= index < len(infer_queue)
+    status = infer_queue.wait_all()
+    assert status == ie.StatusCode.OK
+    assert sorted(results.keys()) == list(range(num_jobs))
+    assert all(result == (ie.StatusCode.OK, 2) for result in results.values())
+    del infer_queue
+    del exec_net
+
+
+def test_start_async_wrong_input_name(device):
+    exec_net = load_sample_model(device)
+    infer_queue = ie.InferRequestsQueue(exec_net, num_requests=1)
+    img = read_image()
+    with pytest.raises(AssertionError) as e:
+        infer_queue.start_async({'_data_': img})
+    assert "No input with name _data_ found in network" in str(e.value)
+    # request has to be given back to the queue after a failed submission
+    assert infer_queue.wait_all(timeout=1000) == ie.StatusCode.OK
+    del infer_queue
+    del exec_net
+
+
+def test_wait_all_zero_timeout_polls(device):
+    exec_net = load_sample_model(device)
+    infer_queue = ie.InferRequestsQueue(exec_net, num_requests=1)
+    img = read_image()
+    release = threading.Event()
+
+    def callback(request, status, userdata):
+        release.wait()
+
+    infer_queue.set_callback(callback)
+    assert infer_queue.wait_all(timeout=0) == ie.StatusCode.OK
+    infer_queue.start_async({'data': img})
+    # the job can't finish while its callback is blocked, so a poll must return at once
+    assert infer_queue.wait_all(timeout=0) == ie.StatusCode.RESULT_NOT_READY
+    release.set()
+    assert infer_queue.wait_all() == ie.StatusCode.OK
+    del infer_queue
+    del exec_net
+
+
+def test_wait_on_pooled_request_during_submissions(device):
+    exec_net = load_sample_model(device)
+    infer_queue = ie.InferRequestsQueue(exec_net, num_requests=2)
+    img = read_image()
+    results = {}
+    lock = threading.Lock()
+
+    def callback(request, status, job_id):
+        with lock:
+            results[job_id] = status
+
+    infer_queue.set_callback(callback)
+    stop = threading.Event()
+
+    # waiting for a pooled request must not give it back to the queue
+    def poll_requests():
+        while not stop.is_set():
+            for request in infer_queue.requests:
+                request.wait(ie.WaitMode.STATUS_ONLY)
+
+    poller = threading.Thread(target=poll_requests)
+    poller.start()
+    num_jobs = 50
+    try:
+        for job_id in range(num_jobs):
+            infer_queue.start_async({'data': img}, userdata=job_id)
+    finally:
+        stop.set()
+        poller.join()
+    assert infer_queue.wait_all() == ie.StatusCode.OK
+    assert sorted(results.keys()) == list(range(num_jobs))
+    assert all(status == ie.StatusCode.OK for status in results.values())
+    del infer_queue
+    del exec_net
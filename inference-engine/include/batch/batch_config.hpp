@@ -0,0 +1,70 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for the Batch plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods
+ *
+ * @file batch_config.hpp
+ */
+
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Batch plugin configuration
+ */
+namespace BatchConfigParams {
+
+/**
+ * @def BATCH_CONFIG_KEY(name)
+ * @brief A macro which provides a BATCH-mangled name for configuration key with name `name`
+ */
+#define BATCH_CONFIG_KEY(name) InferenceEngine::BatchConfigParams::_CONFIG_KEY(BATCH_##name)
+
+#define DECLARE_BATCH_CONFIG_KEY(name) DECLARE_CONFIG_KEY(BATCH_##name)
+
+/**
+ * @brief The device which executes batched requests, e.g. "CPU". The "BATCH:<device>" device name sets this key
+ */
+DECLARE_BATCH_CONFIG_KEY(DEVICE);
+
+/**
+ * @brief The maximum number of requests stacked into one batched request, 8 by default
+ */
+DECLARE_BATCH_CONFIG_KEY(SIZE);
+
+/**
+ * @brief The time in milliseconds the first request of a batch waits for other requests, 1 by default.
+ * A batch which is not full by this time is executed as is
+ */
+DECLARE_BATCH_CONFIG_KEY(TIMEOUT);
+
+}  // namespace BatchConfigParams
+
+/**
+ * @def BATCH_METRIC_KEY(name)
+ * @brief A macro which provides a BATCH-mangled name for metric with name `name`
+ */
+#define BATCH_METRIC_KEY(name) METRIC_KEY(BATCH_##name)
+#define DECLARE_BATCH_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(BATCH_##name, __VA_ARGS__)
+
+namespace Metrics {
+
+/**
+ * @brief Metric of an executable network to get the average number of requests in executed batches
+ */
+DECLARE_BATCH_METRIC_KEY(AVERAGE_BATCH_SIZE, float);
+
+/**
+ * @brief Metric of an executable network to get the average time in milliseconds a request waits
+ * until its batch is started on the device
+ */
+DECLARE_BATCH_METRIC_KEY(AVERAGE_QUEUEING_DELAY, float);
+
+}  // namespace Metrics
+}  // namespace InferenceEngine
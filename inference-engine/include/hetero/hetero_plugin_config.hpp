@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
@@ -28,6 +30,12 @@ namespace HeteroConfigParams {
 #define DECLARE_HETERO_CONFIG_KEY(name) DECLARE_CONFIG_KEY(HETERO_##name)
 #define DECLARE_HETERO_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(HETERO_##name)
 
+/**
+ * @def HETERO_CONFIG_VALUE(name)
+ * @brief Shortcut for defining HETERO configuration values
+ */
+#define HETERO_CONFIG_VALUE(name) InferenceEngine::HeteroConfigParams::HETERO_##name
+
 /**
  * @brief The key for enabling of dumping the topology with details of layers and details how
  * this network would be executed on different devices to the disk in GraphViz format.
@@ -35,5 +43,69 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of pipelined execution of subgraphs.
+ * Subgraphs are loaded to devices without exclusive async requests mode, so the next subgraph of one infer request
+ * runs concurrently with the previous subgraph of another infer request, and the optimal number of infer requests
+ * is reported so that every subgraph has its own requests in flight.
+ * Loading of a network fails if CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS) is explicitly set to CONFIG_VALUE(YES) as well.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINED);
+
+/**
+ * @brief The key to choose how operations without user defined affinity are assigned to devices.
+ * This option should be used with values:
+ *  - HETERO_CONFIG_VALUE(PRIORITY) (default) - an operation is assigned to the first device
+ *    in the TARGET_FALLBACK list which supports it
+ *  - HETERO_CONFIG_VALUE(COST_MODEL) - operations are assigned to devices to minimize the estimated latency
+ *    of the network including data transfers between subgraphs
+ */
+DECLARE_HETERO_CONFIG_KEY(PARTITIONING);
+DECLARE_HETERO_CONFIG_VALUE(PRIORITY);
+DECLARE_HETERO_CONFIG_VALUE(COST_MODEL);
+
+/**
+ * @brief The key to limit the number of subgraphs created by HETERO_CONFIG_VALUE(COST_MODEL) partitioning.
+ * Loading of the network fails if it can't be split into at most this number of subgraphs.
+ * This option should be used with an unsigned integer value, 0 (default) means no limit
+ */
+DECLARE_HETERO_CONFIG_KEY(MAX_SUBGRAPHS);
+
+/**
+ * @brief The key to set device throughputs used by HETERO_CONFIG_VALUE(COST_MODEL) partitioning to estimate
+ * time of operations.
+ * This option should be used with a comma separated list of <device>:<giga operations per second> pairs,
+ * for example "GPU:400,CPU:100". Devices which are not listed are assumed to do 100 giga operations per second
+ */
+DECLARE_HETERO_CONFIG_KEY(DEVICE_GOPS);
+
+/**
+ * @brief The key to set bandwidth of data transfers between devices used by HETERO_CONFIG_VALUE(COST_MODEL)
+ * partitioning to estimate time of transfers.
+ * This option should be used with a positive number of gigabytes per second, "10" is the default
+ */
+DECLARE_HETERO_CONFIG_KEY(TRANSFER_GBPS);
+
 }  // namespace HeteroConfigParams
+
+/**
+ * @def HETERO_METRIC_KEY(name)
+ * @brief Shortcut for defining HETERO metric keys
+ */
+#define HETERO_METRIC_KEY(name) METRIC_KEY(HETERO_##name)
+#define DECLARE_HETERO_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(HETERO_##name, __VA_ARGS__)
+
+namespace Metrics {
+
+/**
+ * @brief Metric of an executable network to get an estimate of the number of bytes of intermediate blobs which are
+ * copied between devices and subgraph requests during one inference.
+ * The estimate is derived from the loaded subgraphs, copies are not measured at runtime. An intermediate blob is
+ * counted once for the producer and once for every consumer subgraph, except for subgraphs which report it in
+ * METRIC_KEY(ZERO_COPY_BLOBS) and use host memory directly.
+ */
+DECLARE_HETERO_METRIC_KEY(ESTIMATED_BYTES_COPIED_PER_INFERENCE, std::uint64_t);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
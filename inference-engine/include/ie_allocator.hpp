@@ -73,4 +73,23 @@ protected:
  */
 INFERENCE_ENGINE_API(InferenceEngine::IAllocator*) CreateDefaultAllocator() noexcept;
 
+/**
+ * @brief Creates an allocator placing memory into POSIX shared memory, so that blobs of one process can be used by
+ * other processes and bound to their infer requests without copying.
+ *
+ * Every allocation maps a separate shared memory object:
+ *  - if create is `true`, the allocation creates the object named name (it must not exist) and the object is unlinked
+ *    when the memory is freed. Processes which mapped it before keep their mappings. If name is empty, anonymous
+ *    shared memory is used, which is only shared with processes forked after the allocation.
+ *  - otherwise the allocation maps an existing object named name starting from offset. The object is kept when
+ *    the memory is freed.
+ *
+ * @param name Name of the shared memory object as for shm_open(), e.g. "/frames"
+ * @param create Whether allocations create the shared memory object or map an existing one
+ * @param offset Offset of the memory in an existing shared memory object, ignored if create is `true`
+ * @return The Inference Engine IAllocator* instance or `nullptr` if shared memory is not supported on the platform
+ */
+INFERENCE_ENGINE_API(InferenceEngine::IAllocator*) CreateSharedMemoryAllocator(const char* name, bool create,
+                                                                                size_t offset = 0) noexcept;
+
 }  // namespace InferenceEngine
@@ -872,6 +872,35 @@ inline typename InferenceEngine::TBlob<Type>::Ptr make_shared_blob(
     return std::make_shared<InferenceEngine::TBlob<Type>>(tensorDesc, alloc);
 }
 
+/**
+ * @brief Creates a blob over an existing POSIX shared memory object without copying its data.
+ *
+ * The object can be created by another process, for example, with a blob using CreateSharedMemoryAllocator().
+ *
+ * @tparam Type Type of the shared pointer to be created
+ * @param tensorDesc Tensor descriptor for Blob creation
+ * @param shmName Name of the shared memory object as for shm_open()
+ * @param offset Offset of the blob data in the shared memory object, must be a multiple of alignof(Type)
+ * @return A shared pointer to the newly created and allocated blob of the given type
+ */
+template <typename Type>
+inline typename InferenceEngine::TBlob<Type>::Ptr make_shared_memory_blob(const TensorDesc& tensorDesc,
+                                                                          const std::string& shmName,
+                                                                          size_t offset = 0) {
+    if (offset % alignof(Type) != 0)
+        THROW_IE_EXCEPTION << "Cannot make shared memory blob! Offset " << offset
+                           << " is not a multiple of the blob element alignment " << alignof(Type);
+    auto allocator = CreateSharedMemoryAllocator(shmName.c_str(), false, offset);
+    if (allocator == nullptr)
+        THROW_IE_EXCEPTION << "Cannot make shared memory blob! Shared memory is not supported on this platform";
+    auto blob = make_shared_blob<Type>(tensorDesc, details::shared_from_irelease(allocator));
+    blob->allocate();
+    if (blob->data() == nullptr)
+        THROW_IE_EXCEPTION << "Cannot make shared memory blob! Cannot map " << blob->byteSize()
+                           << " bytes of shared memory object " << shmName << " at offset " << offset;
+    return blob;
+}
+
 /**
  * @brief Creates a copy of given TBlob instance.
  *
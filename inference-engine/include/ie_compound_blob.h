@@ -311,4 +311,49 @@ class INFERENCE_ENGINE_API_CLASS(BatchedBlob) : public CompoundBlob {
      */
     explicit BatchedBlob(std::vector<Blob::Ptr>&& blobs);
 };
+
+/**
+ * @brief This class represents a batch of images which may differ in spatial dimensions - one image per batch
+ * @details Unlike BatchedBlob, the contained blobs do not have equal tensor descriptors (e.g. they are ROIs
+ * of different size), so the blob can only be passed to an input with a resize algorithm set: every image is
+ * resized to the network's input size by input pre-processing.
+ */
+class INFERENCE_ENGINE_API_CLASS(VariableSizeBatchedBlob) : public CompoundBlob {
+public:
+    /**
+     * @brief A smart pointer to the VariableSizeBatchedBlob object
+     */
+    using Ptr = std::shared_ptr<VariableSizeBatchedBlob>;
+
+    /**
+     * @brief A smart pointer to the const VariableSizeBatchedBlob object
+     */
+    using CPtr = std::shared_ptr<const VariableSizeBatchedBlob>;
+
+    /**
+     * @brief Constructs a batch of images from a vector of blobs
+     * @details All passed blobs should meet following requirements:
+     * - all blobs have equal precisions, layouts and numbers of channels,
+     * - blobs layouts should be one of: NCHW, NHWC
+     * - batch dimensions should be equal to 1.
+     * Resulting blob's tensor descriptor is constructed using tensor descriptor
+     * of the first blob by setting batch dimension to blobs.size()
+     *
+     * @param blobs A vector of blobs that is copied to this object
+     */
+    explicit VariableSizeBatchedBlob(const std::vector<Blob::Ptr>& blobs);
+
+    /**
+     * @brief Constructs a batch of images from a vector of blobs
+     * @details All passed blobs should meet following requirements:
+     * - all blobs have equal precisions, layouts and numbers of channels,
+     * - blobs layouts should be one of: NCHW, NHWC
+     * - batch dimensions should be equal to 1.
+     * Resulting blob's tensor descriptor is constructed using tensor descriptor
+     * of the first blob by setting batch dimension to blobs.size()
+     *
+     * @param blobs A vector of blobs that is moved to this object
+     */
+    explicit VariableSizeBatchedBlob(std::vector<Blob::Ptr>&& blobs);
+};
 }  // namespace InferenceEngine
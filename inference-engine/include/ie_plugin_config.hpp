@@ -158,6 +158,13 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get names of executable network inputs and outputs which use memory of blobs set to an infer
+ * request directly, without copying it to or from device memory, if a blob has the tensor descriptor of the input or
+ * output. String value is "ZERO_COPY_BLOBS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(ZERO_COPY_BLOBS, std::vector<std::string>);
+
 }  // namespace Metrics
 
 /**
@@ -362,6 +369,19 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief The name for setting to fold input pre-processing into the first layer of the network
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES (per-channel mean values of an input are folded into the biases of a convolution
+ * consuming the input, so raw input data is read only by the convolution; the weights are not changed)
+ * PluginConfigParams::NO (default, pre-processing is applied to the input data before inference)
+ * Inputs which can't be folded (scales other than 1, mean image, padded convolution, several consumers)
+ * are pre-processed as usual.
+ * This is a CPU-specific knob.
+ */
+DECLARE_CONFIG_KEY(CPU_FOLD_PREPROCESSING);
+
 /**
 * @brief This key defines the directory which will be used to store any data cached by plugins.
 *
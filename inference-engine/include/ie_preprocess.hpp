@@ -47,7 +47,16 @@ enum MeanVariant {
  * @enum ResizeAlgorithm
  * @brief Represents the list of supported resize algorithms.
  */
-enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA };
+enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA, RESIZE_NEAREST, RESIZE_BICUBIC };
+
+/**
+ * @enum ResizeMode
+ * @brief Represents the way an input image is fitted into the network's input during resize.
+ */
+enum ResizeMode {
+    RESIZE_STRETCH = 0,  /**< the image is resized to the network's input size, aspect ratio is not kept */
+    RESIZE_LETTERBOX,    /**< the image is resized keeping its aspect ratio, centered and padded with a constant */
+};
 
 /**
  * @brief This class stores pre-process information for the input
@@ -60,6 +69,12 @@ class PreProcessInfo {
     // Resize Algorithm to be applied for input before inference if needed.
     ResizeAlgorithm _resizeAlg = NO_RESIZE;
 
+    // The way an input is fitted into the network's input when resize is applied
+    ResizeMode _resizeMode = RESIZE_STRETCH;
+
+    // Value used to fill the area not covered by the image in letterbox resize mode
+    float _padValue = 0.f;
+
     // Color format to be used in on-demand color conversions applied to input before inference
     ColorFormat _colorFormat = ColorFormat::RAW;
 
@@ -198,6 +213,38 @@ public:
         return _resizeAlg;
     }
 
+    /**
+     * @brief Sets the way an input image is fitted into the network's input during resize
+     *
+     * @details The mode takes effect only if a resize algorithm is set. In ResizeMode::RESIZE_LETTERBOX mode
+     *          the image is scaled by the same factor along both axes so that it fits the network's input,
+     *          placed at its center and the rest of the input is filled with the pad value.
+     * @param mode Resize mode
+     * @param padValue Value to fill the area not covered by the image with
+     */
+    void setResizeMode(const ResizeMode& mode, float padValue = 0.f) {
+        _resizeMode = mode;
+        _padValue = padValue;
+    }
+
+    /**
+     * @brief Gets preconfigured resize mode
+     *
+     * @return Resize mode
+     */
+    ResizeMode getResizeMode() const {
+        return _resizeMode;
+    }
+
+    /**
+     * @brief Gets the value the network's input is padded with in letterbox resize mode
+     *
+     * @return Pad value
+     */
+    float getPadValue() const {
+        return _padValue;
+    }
+
     /**
      * @brief Changes the color format of the input data provided by the user
      *
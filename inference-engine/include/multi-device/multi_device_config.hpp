@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
@@ -29,10 +32,49 @@ namespace MultiDeviceConfigParams {
 #define DECLARE_MULTI_CONFIG_KEY(name) DECLARE_CONFIG_KEY(MULTI_##name)
 #define DECLARE_MULTI_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(MULTI_##name)
 
+/**
+ * @def MULTI_CONFIG_VALUE(name)
+ * @brief A macro which provides a MULTI-mangled name for configuration value with name `name`
+ */
+#define MULTI_CONFIG_VALUE(name) InferenceEngine::MultiDeviceConfigParams::MULTI_##name
+
 /**
  * @brief Device Priorities config option, with comma-separated devices listed in the desired priority
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief The key to choose a device for every infer request. This option should be used with values:
+ *  - MULTI_CONFIG_VALUE(PRIORITY) (default) - the first device in the DEVICE_PRIORITIES list with an idle request
+ *  - MULTI_CONFIG_VALUE(EARLIEST_COMPLETION) - among devices with an idle request, the one with the earliest expected
+ *    completion of the request, estimated from the running average latency and the number of requests in flight on
+ *    the device. If no device has an idle request, the request is executed by the first device which becomes idle
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(EARLIEST_COMPLETION);
+
 }  // namespace MultiDeviceConfigParams
+
+/**
+ * @def MULTI_METRIC_KEY(name)
+ * @brief A macro which provides a MULTI-mangled name for metric with name `name`
+ */
+#define MULTI_METRIC_KEY(name) METRIC_KEY(MULTI_##name)
+#define DECLARE_MULTI_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(MULTI_##name, __VA_ARGS__)
+
+namespace Metrics {
+
+/**
+ * @brief Metric of an executable network to get the number of inferences per second completed by each device
+ * since the first inference on the device
+ */
+DECLARE_MULTI_METRIC_KEY(DEVICE_THROUGHPUT, std::map<std::string, float>);
+
+/**
+ * @brief Metric of an executable network to get the running average latency of each device in milliseconds
+ */
+DECLARE_MULTI_METRIC_KEY(DEVICE_LATENCY, std::map<std::string, float>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "autotune.hpp"
+
+namespace {
+// relative improvement which is required to continue the search
+constexpr double minImprovement = 0.02;
+}  // namespace
+
+AutotuneTrial autotune(const std::string& objective, double latencyBound, uint32_t hwThreads, uint32_t physicalCores,
+                       const AutotuneTrialFunction& runTrial, std::vector<AutotuneTrial>& trials) {
+    if (hwThreads == 0)
+        hwThreads = 1;
+    if (physicalCores == 0 || physicalCores > hwThreads)
+        physicalCores = hwThreads;
+
+    bool found = false;
+    AutotuneTrial best {};
+    auto evaluate = [&] (const AutotuneCandidate& candidate) {
+        auto trial = runTrial(candidate);
+        trials.push_back(trial);
+        if (objective == throughputObjective) {
+            if (latencyBound > 0.0 && trial.p99Latency > latencyBound)
+                return false;
+            if (!found || trial.throughput > best.throughput * (1.0 + minImprovement)) {
+                best = trial;
+                found = true;
+                return true;
+            }
+        } else {
+            if (!found || trial.medianLatency < best.medianLatency * (1.0 - minImprovement)) {
+                best = trial;
+                found = true;
+                return true;
+            }
+        }
+        return false;
+    };
+
+    if (objective == throughputObjective) {
+        for (uint32_t streams = 1; streams <= hwThreads; streams *= 2) {
+            bool improved = false;
+            for (auto nireq : {streams, 2 * streams}) {
+                improved = evaluate({streams, 0, nireq}) || improved;
+            }
+            // stop once more streams do not help; a violated latency bound only gets worse with more streams
+            if (streams > 1 && !improved)
+                break;
+        }
+        // hyper-threads rarely help throughput of compute-bound streams, check physical cores only
+        if (found && physicalCores < hwThreads && physicalCores >= best.candidate.streams) {
+            auto candidate = best.candidate;
+            candidate.threads = physicalCores;
+            evaluate(candidate);
+        }
+    } else if (objective == latencyObjective) {
+        evaluate({1, 0, 1});
+        for (uint32_t threads = physicalCores; threads >= 1; threads /= 2) {
+            if (!evaluate({1, threads, 1}))
+                break;
+        }
+    } else {
+        throw std::logic_error("Unknown autotune objective: " + objective);
+    }
+
+    if (!found) {
+        throw std::runtime_error("Autotune failed: none of the configurations meets p99 latency bound of " +
+                                 std::to_string(latencyBound) + " ms");
+    }
+    return best;
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// @brief autotune objectives
+static constexpr char throughputObjective[] = "throughput";
+static constexpr char latencyObjective[] = "latency";
+
+/// @brief CPU configuration evaluated by the autotuner
+struct AutotuneCandidate {
+    uint32_t streams;
+    uint32_t threads;  // 0 means that the number of threads is chosen by the plugin
+    uint32_t nireq;
+};
+
+/// @brief Measurement of a single candidate
+struct AutotuneTrial {
+    AutotuneCandidate candidate;
+    double throughput;     // FPS
+    double medianLatency;  // ms
+    double p99Latency;     // ms
+};
+
+using AutotuneTrialFunction = std::function<AutotuneTrial(const AutotuneCandidate&)>;
+
+/**
+* @brief Searches for the CPU streams, threads and requests configuration which gives the best objective value.
+* For the throughput objective, the number of streams is doubled while it improves throughput, and candidates
+* violating p99 latency bound (if non-zero) are rejected. For the latency objective, the number of threads of a
+* single stream is halved, starting from the number of physical cores, while it improves the median latency.
+* @param objective Either throughputObjective or latencyObjective
+* @param latencyBound p99 latency bound in milliseconds for the throughput objective, 0 means no bound
+* @param hwThreads Number of hardware threads available to inference
+* @param physicalCores Number of physical CPU cores, equal to hwThreads if there are no hyper-threads
+* @param runTrial Function which loads the network with candidate configuration and measures it
+* @param trials All executed trials in the execution order
+* @return The best trial
+*/
+AutotuneTrial autotune(const std::string& objective, double latencyBound, uint32_t hwThreads, uint32_t physicalCores,
+                       const AutotuneTrialFunction& runTrial, std::vector<AutotuneTrial>& trials);
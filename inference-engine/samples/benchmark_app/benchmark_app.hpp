@@ -37,6 +37,40 @@ static const char infer_requests_count_message[] = "Optional. Number of infer re
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for open-loop arrival rates
+static const char arrival_rate_message[] = "Optional. Enables open-loop mode: comma-separated list of target arrival rates "
+                                           "(inferences per second) which are measured one after another, each for the "
+                                           "given duration or number of iterations. Inferences arriving while all infer "
+                                           "requests are busy are dropped. Requires async API.";
+
+/// @brief message for open-loop arrival distribution
+static const char arrival_distribution_message[] = "Optional. Distribution of inter-arrival times in open-loop mode, also for -colocate_rate: "
+                                                   "\"constant\" (default) or \"poisson\".";
+
+/// @brief message for co-located models
+static const char colocate_message[] = "Optional. Comma-separated list of models to run concurrently with the -m model on the same "
+                                       "device. Each model is measured alone and then together with the others to report interference.";
+
+/// @brief message for per-model streams of co-located models
+static const char colocate_nstreams_message[] = "Optional. Comma-separated list of numbers of streams for -m and each of -colocate "
+                                                "models in the same order. Empty value means default for a device.";
+
+/// @brief message for per-model arrival rates of co-located models
+static const char colocate_rate_message[] = "Optional. Comma-separated list of arrival rates (inferences per second) for -m and "
+                                            "each of -colocate models in the same order. Empty or 0 value means closed loop.";
+
+/// @brief message for autotune objective
+static const char autotune_message[] = "Optional. Search for the CPU streams, threads and infer requests configuration "
+                                       "which gives the best \"throughput\" or \"latency\" and use it for the measurement. "
+                                       "Use -dump_config to store the found configuration for -load_config.";
+
+/// @brief message for autotune latency bound
+static const char autotune_latency_bound_message[] = "Optional. p99 latency bound in milliseconds for the throughput "
+                                                     "autotune objective. Configurations exceeding it are rejected.";
+
+/// @brief message for autotune trial time
+static const char autotune_time_message[] = "Optional. Time in seconds to measure each autotune candidate. Default value is 3.";
+
 /// @brief message for #threads for CPU inference
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU "
                                                 "(including HETERO and MULTI cases).";
@@ -90,6 +124,18 @@ static const char progress_message[] = "Optional. Show progress bar (can affect
 // @brief message for performance counters option
 static const char pc_message[] = "Optional. Report performance counters.";
 
+// @brief message for latency percentiles option
+static const char latency_percentiles_message[] = "Optional. Comma-separated list of latency percentiles to report, "
+                                                  "for example \"50,90,99,99.9\". Percentiles of the time spent waiting "
+                                                  "for an idle infer request are reported as well.";
+
+// @brief message for latency histogram option
+static const char latency_histogram_message[] = "Optional. Print latency histogram with log-linear buckets.";
+
+// @brief message for timeline path option
+static const char timeline_path_message[] = "Optional. Path to a file where to store per-request inference timeline "
+                                            "in Chrome trace event format (can be opened in chrome://tracing).";
+
 #ifdef USE_OPENCV
 // @brief message for load config option
 static const char load_config_message[] = "Optional. Path to XML/YAML/JSON file to load custom IE parameters."
@@ -147,6 +193,30 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Target arrival rates for open-loop mode
+DEFINE_string(arrival_rate, "", arrival_rate_message);
+
+/// @brief Distribution of inter-arrival times for open-loop mode
+DEFINE_string(arrival_distribution, "constant", arrival_distribution_message);
+
+/// @brief Models to run concurrently with -m model
+DEFINE_string(colocate, "", colocate_message);
+
+/// @brief Numbers of streams for co-located models
+DEFINE_string(colocate_nstreams, "", colocate_nstreams_message);
+
+/// @brief Arrival rates for co-located models
+DEFINE_string(colocate_rate, "", colocate_rate_message);
+
+/// @brief Objective of the CPU configuration search
+DEFINE_string(autotune, "", autotune_message);
+
+/// @brief p99 latency bound for the throughput autotune objective
+DEFINE_double(autotune_latency_bound, 0.0, autotune_latency_bound_message);
+
+/// @brief Time to measure each autotune candidate in seconds
+DEFINE_uint32(autotune_time, 3, autotune_time_message);
+
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
 
@@ -181,6 +251,15 @@ DEFINE_bool(progress, false, progress_message);
 /// @brief Define flag for showing performance counters <br>
 DEFINE_bool(pc, false, pc_message);
 
+/// @brief Define flag for latency percentiles to report <br>
+DEFINE_string(latency_percentiles, "", latency_percentiles_message);
+
+/// @brief Define flag for showing latency histogram <br>
+DEFINE_bool(latency_histogram, false, latency_histogram_message);
+
+/// @brief Path to a file where to store per-request inference timeline
+DEFINE_string(timeline_path, "", timeline_path_message);
+
 #ifdef USE_OPENCV
 /// @brief Define flag for loading configuration file <br>
 DEFINE_string(load_config, "", load_config_message);
@@ -222,16 +301,27 @@ static void showUsage() {
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << "    -layout                   " << layout_message << std::endl;
+    std::cout << "    -arrival_rate \"<list>\"    " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival_distribution     " << arrival_distribution_message << std::endl;
+    std::cout << "    -colocate \"<list>\"        " << colocate_message << std::endl;
+    std::cout << "    -colocate_nstreams        " << colocate_nstreams_message << std::endl;
+    std::cout << "    -colocate_rate            " << colocate_rate_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
     std::cout << "    -enforcebf16              " << enforce_bf16_message << std::endl;
     std::cout << "    -pin \"YES\"/\"NO\"/\"NUMA\"    " << infer_threads_pinning_message << std::endl;
+    std::cout << "    -autotune \"<objective>\"   " << autotune_message << std::endl;
+    std::cout << "    -autotune_latency_bound   " << autotune_latency_bound_message << std::endl;
+    std::cout << "    -autotune_time            " << autotune_time_message << std::endl;
     std::cout << std::endl << "  Statistics dumping options:" << std::endl;
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
+    std::cout << "    -latency_percentiles      " << latency_percentiles_message << std::endl;
+    std::cout << "    -latency_histogram        " << latency_histogram_message << std::endl;
+    std::cout << "    -timeline_path            " << timeline_path_message << std::endl;
 #ifdef USE_OPENCV
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
     std::cout << "    -load_config              " << load_config_message << std::endl;
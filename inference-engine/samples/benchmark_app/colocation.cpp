@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <samples/slog.hpp>
+
+#include "colocation.hpp"
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "load_generator.hpp"
+#include "utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+struct LoadedModel {
+    ColocatedModel model;
+    ExecutableNetwork network;
+    size_t batchSize;
+    std::unique_ptr<InferRequestsQueue> queue;
+};
+
+LoadResult runModel(LoadedModel& loadedModel, bool poisson, uint64_t duration_nanoseconds) {
+    return loadedModel.model.rate > 0.0 ?
+           runOpenLoop(*loadedModel.queue, loadedModel.model.rate, poisson, duration_nanoseconds, 0) :
+           runClosedLoop(*loadedModel.queue, duration_nanoseconds, 0);
+}
+
+std::string to_string(const double number) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << number;
+    return ss.str();
+}
+
+std::string describe(const LoadResult& result, size_t batchSize) {
+    auto latencies = result.latencies;
+    std::sort(latencies.begin(), latencies.end());
+    std::stringstream ss;
+    ss << to_string(result.getThroughput(batchSize)) << " FPS";
+    if (!latencies.empty()) {
+        ss << ", latency p50 " << to_string(StatisticsReport::getPercentile(latencies, 50))
+           << " ms, p99 " << to_string(StatisticsReport::getPercentile(latencies, 99)) << " ms";
+    }
+    if (result.dropped != 0)
+        ss << ", " << result.dropped << " dropped";
+    return ss.str();
+}
+
+}  // namespace
+
+std::vector<ColocatedModel> parseColocatedModels(const std::string& models_string,
+                                                 const std::string& nstreams_string,
+                                                 const std::string& rates_string) {
+    auto paths = split(models_string, ',');
+    auto nstreams = split(nstreams_string, ',');
+    auto rates = split(rates_string, ',');
+    if (nstreams.size() > paths.size() || rates.size() > paths.size()) {
+        throw std::logic_error("Number of per-model streams or rates values exceeds the number of co-located models");
+    }
+
+    std::vector<ColocatedModel> models;
+    for (size_t i = 0; i < paths.size(); i++) {
+        ColocatedModel model {paths[i], i < nstreams.size() ? nstreams[i] : "", 0.0};
+        if (i < rates.size() && !rates[i].empty()) {
+            try {
+                model.rate = std::stod(rates[i]);
+            } catch (const std::exception&) {
+                throw std::logic_error("Incorrect arrival rate value: " + rates[i]);
+            }
+            if (model.rate < 0.0)
+                throw std::logic_error("Arrival rate should not be negative, got " + rates[i]);
+        }
+        models.push_back(model);
+    }
+    return models;
+}
+
+void runColocation(Core& ie, const std::string& device_name,
+                   const std::vector<ColocatedModel>& models, uint32_t nireq, bool poisson, uint64_t duration_nanoseconds,
+                   const std::shared_ptr<StatisticsReport>& statistics) {
+    std::vector<LoadedModel> loadedModels(models.size());
+    for (size_t i = 0; i < models.size(); i++) {
+        auto& loadedModel = loadedModels[i];
+        loadedModel.model = models[i];
+
+        CNNNetwork cnnNetwork = ie.ReadNetwork(models[i].path);
+        const InputsDataMap inputInfo(cnnNetwork.getInputsInfo());
+        auto app_inputs_info = getInputsInfo<InputInfo::Ptr>("", "", 0, inputInfo);
+        for (auto& item : inputInfo) {
+            if (app_inputs_info.at(item.first).isImage()) {
+                app_inputs_info.at(item.first).precision = Precision::U8;
+                item.second->setPrecision(Precision::U8);
+            }
+        }
+        loadedModel.batchSize = cnnNetwork.getBatchSize();
+
+        std::map<std::string, std::string> config;
+        if (!models[i].nstreams.empty())
+            config[device_name + "_THROUGHPUT_STREAMS"] = models[i].nstreams;
+        loadedModel.network = ie.LoadNetwork(cnnNetwork, device_name, config);
+
+        uint32_t modelNireq = nireq != 0 ? nireq :
+                              loadedModel.network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        loadedModel.queue.reset(new InferRequestsQueue(loadedModel.network, modelNireq));
+        fillBlobs({}, loadedModel.batchSize, app_inputs_info, loadedModel.queue->requests);
+
+        // warming up - out of scope
+        loadedModel.queue->getIdleRequest()->startAsync();
+        loadedModel.queue->waitAll();
+
+        slog::info << "Model " << models[i].path << " is loaded with "
+                   << (models[i].nstreams.empty() ? "default number of" : models[i].nstreams) << " streams, "
+                   << modelNireq << " infer requests, "
+                   << (models[i].rate > 0.0 ? to_string(models[i].rate) + " inferences/s arrival rate" : "closed loop") << slog::endl;
+    }
+
+    slog::info << "Measuring each model alone" << slog::endl;
+    std::vector<LoadResult> isolated;
+    for (auto& loadedModel : loadedModels) {
+        isolated.push_back(runModel(loadedModel, poisson, duration_nanoseconds));
+    }
+
+    slog::info << "Measuring all models concurrently" << slog::endl;
+    std::vector<LoadResult> colocated(loadedModels.size());
+    std::vector<std::exception_ptr> errors(loadedModels.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < loadedModels.size(); i++) {
+        threads.emplace_back([&, i] {
+            try {
+                colocated[i] = runModel(loadedModels[i], poisson, duration_nanoseconds);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    std::cout << "Co-location results:" << std::endl;
+    for (size_t i = 0; i < loadedModels.size(); i++) {
+        const auto batchSize = loadedModels[i].batchSize;
+        const auto isolatedThroughput = isolated[i].getThroughput(batchSize);
+        const auto colocatedThroughput = colocated[i].getThroughput(batchSize);
+        const auto interference = isolatedThroughput == 0.0 ? 0.0 : 100.0 * (1.0 - colocatedThroughput / isolatedThroughput);
+
+        std::cout << "  " << loadedModels[i].model.path << std::endl;
+        std::cout << "    alone:        " << describe(isolated[i], batchSize) << std::endl;
+        std::cout << "    co-located:   " << describe(colocated[i], batchSize) << std::endl;
+        std::cout << "    interference: " << to_string(interference) << "% of throughput lost" << std::endl;
+
+        if (statistics) {
+            const auto prefix = loadedModels[i].model.path + ": ";
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                              {prefix + "throughput alone", to_string(isolatedThroughput)},
+                                              {prefix + "throughput co-located", to_string(colocatedThroughput)},
+                                              {prefix + "interference (%)", to_string(interference)},
+                                      });
+        }
+    }
+}
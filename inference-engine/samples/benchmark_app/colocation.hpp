@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include "statistics_report.hpp"
+
+/// @brief Model which is executed concurrently with other models on the same device
+struct ColocatedModel {
+    std::string path;
+    std::string nstreams;  // empty means default number of streams for the device
+    double rate;           // target arrival rate (inferences per second), 0 means closed loop
+};
+
+/// @brief Parses comma-separated lists of model paths and per-model numbers of streams and arrival rates
+std::vector<ColocatedModel> parseColocatedModels(const std::string& models_string,
+                                                 const std::string& nstreams_string,
+                                                 const std::string& rates_string);
+
+/**
+* @brief Measures each model alone and then all models concurrently on the same device. Reports per-model
+* throughput and latency for both runs, and the throughput lost due to interference of co-located models.
+* @param nireq Number of infer requests per model, 0 means the optimal number reported by the device
+* @param poisson Use exponentially distributed inter-arrival times for models with an arrival rate
+*/
+void runColocation(InferenceEngine::Core& ie, const std::string& device_name,
+                   const std::vector<ColocatedModel>& models, uint32_t nireq, bool poisson, uint64_t duration_nanoseconds,
+                   const std::shared_ptr<StatisticsReport>& statistics);
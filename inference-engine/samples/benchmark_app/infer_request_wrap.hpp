@@ -46,6 +46,12 @@ public:
         _request.StartAsync();
     }
 
+    /// @brief Starts inference which arrived at the specified time, so the latency includes submission delay
+    void startAsync(const Time::time_point& arrivalTime) {
+        _startTime = arrivalTime;
+        _request.StartAsync();
+    }
+
     void wait() {
         _request.Wait(InferenceEngine::IInferRequest::RESULT_READY);
     }
@@ -70,10 +76,23 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    Time::time_point getStartTime() const {
+        return _startTime;
+    }
+
+    void setIdleWaitTime(const ns waitTime) {
+        _idleWaitTime = waitTime;
+    }
+
+    double getIdleWaitTimeInMilliseconds() const {
+        return static_cast<double>(_idleWaitTime.count()) * 0.000001;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
     Time::time_point _startTime;
     Time::time_point _endTime;
+    ns _idleWaitTime {0};
     size_t _id;
     QueueCallbackFunction _callbackQueue;
 };
@@ -99,9 +118,11 @@ public:
     }
 
     void resetTimes() {
+        _runStartTime = Time::now();
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _records.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -112,6 +133,8 @@ public:
                         const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        const auto& request = requests.at(id);
+        _records.push_back({id, request->getStartTime(), request->getIdleWaitTimeInMilliseconds(), latency});
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -119,8 +142,22 @@ public:
 
     InferReqWrap::Ptr getIdleRequest() {
         std::unique_lock<std::mutex> lock(_mutex);
+        auto waitStart = Time::now();
         _cv.wait(lock, [this]{ return _idleIds.size() > 0; });
         auto request = requests.at(_idleIds.front());
+        request->setIdleWaitTime(std::chrono::duration_cast<ns>(Time::now() - waitStart));
+        _idleIds.pop();
+        _startTime = std::min(Time::now(), _startTime);
+        return request;
+    }
+
+    /// @brief Returns an idle request or nullptr if all requests are busy
+    InferReqWrap::Ptr tryGetIdleRequest() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_idleIds.empty())
+            return nullptr;
+        auto request = requests.at(_idleIds.front());
+        request->setIdleWaitTime(ns(0));
         _idleIds.pop();
         _startTime = std::min(Time::now(), _startTime);
         return request;
@@ -135,13 +172,37 @@ public:
         return _latencies;
     }
 
+    /// @brief Returns timings of the completed inferences with start times relative to the start of the run
+    /// @details The run starts at the last resetTimes() call, so no event precedes it even if an inference start
+    ///          is its scheduled arrival (open-loop mode) or the submission was preceded by a wait for an idle request
+    std::vector<StatisticsReport::InferenceRecord> getInferenceRecords() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        std::vector<StatisticsReport::InferenceRecord> records;
+        records.reserve(_records.size());
+        for (const auto& record : _records) {
+            auto startTime = std::chrono::duration_cast<ns>(record.startTime - _runStartTime);
+            records.push_back({record.requestId, static_cast<double>(startTime.count()) * 0.000001,
+                               record.idleWaitTime, record.latency});
+        }
+        return records;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
+    struct Record {
+        size_t requestId;
+        Time::time_point startTime;
+        double idleWaitTime;
+        double latency;
+    };
+
     std::queue<size_t>_idleIds;
     std::mutex _mutex;
     std::condition_variable _cv;
+    Time::time_point _runStartTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<Record> _records;
 };
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "load_generator.hpp"
+
+LoadResult runOpenLoop(InferRequestsQueue& inferRequestsQueue, double rate, bool poisson,
+                       uint64_t duration_nanoseconds, uint32_t niter) {
+    LoadResult result {rate, 0, 0, 0, 0, 0.0, {}};
+
+    std::mt19937 generator(0);
+    std::exponential_distribution<double> interArrival(rate);
+    auto nextInterval = [&] {
+        return std::chrono::duration_cast<Time::duration>(
+            std::chrono::duration<double>(poisson ? interArrival(generator) : 1.0 / rate));
+    };
+
+    inferRequestsQueue.resetTimes();
+    auto startTime = Time::now();
+    auto arrivalTime = startTime;
+    while ((niter != 0 && result.arrivals < niter) ||
+           (duration_nanoseconds != 0 &&
+            static_cast<uint64_t>(std::chrono::duration_cast<ns>(arrivalTime - startTime).count()) < duration_nanoseconds)) {
+        std::this_thread::sleep_until(arrivalTime);
+        auto nextArrivalTime = arrivalTime + nextInterval();
+        result.arrivals++;
+
+        auto inferRequest = inferRequestsQueue.tryGetIdleRequest();
+        if (inferRequest) {
+            // rechecking for exceptions of the previous inference, returns immediately for idle request
+            inferRequest->wait();
+            inferRequest->startAsync(arrivalTime);
+            result.submitted++;
+            // generator did not manage to submit before the next arrival was due
+            if (Time::now() > nextArrivalTime)
+                result.late++;
+        } else {
+            result.dropped++;
+        }
+        arrivalTime = nextArrivalTime;
+    }
+    inferRequestsQueue.waitAll();
+
+    result.duration = inferRequestsQueue.getDurationInMilliseconds();
+    result.latencies = inferRequestsQueue.getLatencies();
+    return result;
+}
+
+LoadResult runClosedLoop(InferRequestsQueue& inferRequestsQueue, uint64_t duration_nanoseconds, uint32_t niter,
+                         bool sync, const std::function<void(size_t, uint64_t)>& onIteration) {
+    LoadResult result {0.0, 0, 0, 0, 0, 0.0, {}};
+
+    inferRequestsQueue.resetTimes();
+    const auto nireq = inferRequestsQueue.requests.size();
+    auto startTime = Time::now();
+    uint64_t execTime = 0;
+    while ((niter != 0 && result.submitted < niter) ||
+           (duration_nanoseconds != 0 && execTime < duration_nanoseconds) ||
+           (!sync && result.submitted % nireq != 0)) {
+        auto inferRequest = inferRequestsQueue.getIdleRequest();
+        if (sync) {
+            inferRequest->infer();
+        } else {
+            // the request is idle, so wait() returns immediately and only rethrows errors of the previous inference
+            inferRequest->wait();
+            inferRequest->startAsync();
+        }
+        result.submitted++;
+
+        execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        if (onIteration)
+            onIteration(result.submitted, execTime);
+    }
+    inferRequestsQueue.waitAll();
+
+    result.arrivals = result.submitted;
+    result.duration = inferRequestsQueue.getDurationInMilliseconds();
+    result.latencies = inferRequestsQueue.getLatencies();
+    return result;
+}
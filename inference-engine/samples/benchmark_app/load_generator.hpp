@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "infer_request_wrap.hpp"
+
+/// @brief Result of driving infer requests with a load generator
+struct LoadResult {
+    double rate;       // target arrival rate, 0 for closed loop
+    size_t arrivals;
+    size_t submitted;
+    size_t dropped;
+    size_t late;
+    double duration;   // ms
+    std::vector<double> latencies;
+
+    double getThroughput(size_t batchSize) const {
+        return submitted == 0 ? 0.0 : batchSize * 1000.0 * submitted / duration;
+    }
+};
+
+/**
+* @brief Submits inferences at the target arrival rate regardless of completions of the previous ones.
+* Inference arriving when all infer requests are busy is dropped, so the number of outstanding inferences
+* is bounded by the number of infer requests. Latency is measured from the scheduled arrival time.
+*/
+LoadResult runOpenLoop(InferRequestsQueue& inferRequestsQueue, double rate, bool poisson,
+                       uint64_t duration_nanoseconds, uint32_t niter);
+
+/**
+* @brief Submits an inference as soon as any infer request becomes idle. In asynchronous mode the number of
+* iterations is aligned by the number of requests, so the last inferences are executed in the same conditions.
+* @param sync Run inferences one by one with the synchronous API
+* @param onIteration Optional callback receiving the number of iterations and elapsed time (ns) after each one
+*/
+LoadResult runClosedLoop(InferRequestsQueue& inferRequestsQueue, uint64_t duration_nanoseconds, uint32_t niter,
+                         bool sync = false,
+                         const std::function<void(size_t, uint64_t)>& onIteration = nullptr);
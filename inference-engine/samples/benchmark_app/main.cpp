@@ -7,6 +7,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -18,7 +19,10 @@
 #include <samples/slog.hpp>
 #include <samples/args_helper.hpp>
 
+#include "autotune.hpp"
 #include "benchmark_app.hpp"
+#include "colocation.hpp"
+#include "load_generator.hpp"
 #include "infer_request_wrap.hpp"
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
@@ -67,6 +71,43 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    parseLatencyPercentiles(FLAGS_latency_percentiles);
+
+    if (!parseArrivalRates(FLAGS_arrival_rate).empty() && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode (-arrival_rate option) is supported for `async` API only.");
+    }
+
+    if (!FLAGS_autotune.empty()) {
+        if (FLAGS_autotune != throughputObjective && FLAGS_autotune != latencyObjective) {
+            throw std::logic_error("Incorrect autotune objective. Please set -autotune option to `" + std::string(throughputObjective) +
+                                   "` or `" + std::string(latencyObjective) + "` value.");
+        }
+        if (FLAGS_d != "CPU" || FLAGS_api != "async") {
+            throw std::logic_error("Autotune (-autotune option) is supported for CPU device and `async` API only.");
+        }
+        if (!FLAGS_nstreams.empty() || FLAGS_nthreads != 0 || FLAGS_nireq != 0) {
+            throw std::logic_error("Autotune (-autotune option) can't be combined with -nstreams, -nthreads and -nireq options.");
+        }
+        if (FLAGS_autotune_time == 0) {
+            throw std::logic_error("Autotune trial time (-autotune_time option) should be positive.");
+        }
+    }
+
+    if (!FLAGS_colocate.empty()) {
+        if (FLAGS_api != "async" || fileExt(FLAGS_m) == "blob") {
+            throw std::logic_error("Co-location (-colocate option) is supported for `async` API and not compiled models only.");
+        }
+        if (!FLAGS_autotune.empty() || !FLAGS_arrival_rate.empty()) {
+            throw std::logic_error("Co-location (-colocate option) can't be combined with -autotune and -arrival_rate options, "
+                                   "use -colocate_nstreams and -colocate_rate instead.");
+        }
+        parseColocatedModels(FLAGS_m + "," + FLAGS_colocate, FLAGS_colocate_nstreams, FLAGS_colocate_rate);
+    }
+
+    if (FLAGS_arrival_distribution != "constant" && FLAGS_arrival_distribution != "poisson") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival_distribution option to `constant` or `poisson` value.");
+    }
+
     return true;
 }
 
@@ -308,6 +349,16 @@ int main(int argc, char *argv[]) {
             ie.SetConfig(item.second, item.first);
         }
 
+        if (!FLAGS_colocate.empty()) {
+            uint32_t duration_seconds = FLAGS_t != 0 ? FLAGS_t : deviceDefaultDeviceDurationInSeconds(device_name);
+            runColocation(ie, device_name, parseColocatedModels(FLAGS_m + "," + FLAGS_colocate, FLAGS_colocate_nstreams, FLAGS_colocate_rate),
+                          FLAGS_nireq, FLAGS_arrival_distribution == "poisson", getDurationInNanoseconds(duration_seconds),
+                          statistics);
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
         auto double_to_string = [] (const double number) {
             std::stringstream ss;
             ss << std::fixed << std::setprecision(2) << number;
@@ -318,6 +369,7 @@ int main(int argc, char *argv[]) {
         };
 
         size_t batchSize = FLAGS_b;
+        uint32_t autotunedNireq = 0;
         Precision precision = Precision::UNSPECIFIED;
         std::string topology_name = "";
         benchmark_app::InputsInfo app_inputs_info;
@@ -382,6 +434,55 @@ int main(int argc, char *argv[]) {
             }
             // ----------------- 7. Loading the model to the device --------------------------------------------------------
             next_step();
+            if (!FLAGS_autotune.empty()) {
+                auto runTrial = [&] (const AutotuneCandidate& candidate) {
+                    auto trialConfig = config.at(device_name);
+                    trialConfig[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(candidate.streams);
+                    trialConfig[CONFIG_KEY(CPU_THREADS_NUM)] = std::to_string(candidate.threads);
+                    auto trialNetwork = ie.LoadNetwork(cnnNetwork, device_name, trialConfig);
+
+                    InferRequestsQueue trialQueue(trialNetwork, candidate.nireq);
+                    fillBlobs(inputFiles, batchSize, app_inputs_info, trialQueue.requests);
+
+                    // warming up - out of scope
+                    trialQueue.getIdleRequest()->startAsync();
+                    trialQueue.waitAll();
+                    trialQueue.resetTimes();
+
+                    auto result = runClosedLoop(trialQueue, getDurationInNanoseconds(FLAGS_autotune_time), 0);
+                    std::sort(result.latencies.begin(), result.latencies.end());
+                    AutotuneTrial trial {candidate,
+                                         result.getThroughput(batchSize),
+                                         StatisticsReport::getPercentile(result.latencies, 50),
+                                         StatisticsReport::getPercentile(result.latencies, 99)};
+                    slog::info << "Autotune trial: " << candidate.streams << " streams, "
+                               << (candidate.threads ? std::to_string(candidate.threads) : "default") << " threads, "
+                               << candidate.nireq << " infer requests: " << double_to_string(trial.throughput) << " FPS, latency p50 "
+                               << double_to_string(trial.medianLatency) << " ms, p99 " << double_to_string(trial.p99Latency) << " ms"
+                               << slog::endl;
+                    return trial;
+                };
+
+                std::vector<AutotuneTrial> trials;
+                auto best = autotune(FLAGS_autotune, FLAGS_autotune_latency_bound, std::thread::hardware_concurrency(),
+                                     getNumberOfPhysicalCores(), runTrial, trials);
+
+                auto& device_config = config.at(device_name);
+                device_config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(best.candidate.streams);
+                device_config[CONFIG_KEY(CPU_THREADS_NUM)] = std::to_string(best.candidate.threads);
+                device_nstreams[device_name] = device_config.at(CONFIG_KEY(CPU_THROUGHPUT_STREAMS));
+                ie.SetConfig(device_config, device_name);
+                autotunedNireq = best.candidate.nireq;
+                slog::info << "Autotune selected " << best.candidate.streams << " streams, "
+                           << (best.candidate.threads ? std::to_string(best.candidate.threads) : "default") << " threads, "
+                           << best.candidate.nireq << " infer requests out of " << trials.size() << " trials" << slog::endl;
+                if (statistics)
+                    statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                              {
+                                                      {"autotune objective", FLAGS_autotune},
+                                                      {"autotune trials", std::to_string(trials.size())},
+                                              });
+            }
             startTime = Time::now();
             exeNetwork = ie.LoadNetwork(cnnNetwork, device_name);
             duration_ms = double_to_string(get_total_ms_time(startTime));
@@ -424,7 +525,7 @@ int main(int argc, char *argv[]) {
         }
 
         // Number of requests
-        uint32_t nireq = FLAGS_nireq;
+        uint32_t nireq = FLAGS_nireq != 0 ? FLAGS_nireq : autotunedNireq;
         if (nireq == 0) {
             if (FLAGS_api == "sync") {
                 nireq = 1;
@@ -548,57 +649,65 @@ int main(int argc, char *argv[]) {
                                         });
         inferRequestsQueue.resetTimes();
 
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.getIdleRequest();
-            if (!inferRequest) {
-                THROW_IE_EXCEPTION << "No idle Infer Requests!";
-            }
-
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                // As the inference request is currently idle, the wait() adds no additional overhead (and should return immediately).
-                // The primary reason for calling the method is exception checking/re-throwing.
-                // Callback, that governs the actual execution can handle errors as well,
-                // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
-                // So, rechecking for any exceptions here.
-                inferRequest->wait();
-                inferRequest->startAsync();
-            }
-            iteration++;
-
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        // Open-loop mode: each rate is measured separately, the summary below is reported for the last one
+        auto arrivalRates = parseArrivalRates(FLAGS_arrival_rate);
+        std::vector<LoadResult> openLoopResults;
+        for (auto rate : arrivalRates) {
+            openLoopResults.push_back(runOpenLoop(inferRequestsQueue, rate, FLAGS_arrival_distribution == "poisson",
+                                                  duration_nanoseconds, niter));
+            iteration = openLoopResults.back().submitted;
+            progressBar.addProgress(progressBarTotalCount / arrivalRates.size());
+        }
 
-            if (niter > 0) {
-                progressBar.addProgress(1);
-            } else {
-                // calculate how many progress intervals are covered by current iteration.
-                // depends on the current iteration time and time of each progress interval.
-                // Previously covered progress intervals must be skipped.
-                auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
-                size_t newProgress = execTime / progressIntervalTime - progressCnt;
-                progressBar.addProgress(newProgress);
-                progressCnt += newProgress;
-            }
+        if (arrivalRates.empty()) {
+            auto closedLoopResult = runClosedLoop(inferRequestsQueue, duration_nanoseconds, niter, FLAGS_api == "sync",
+                                                  [&](size_t, uint64_t execTime) {
+                if (niter > 0) {
+                    progressBar.addProgress(1);
+                } else {
+                    // calculate how many progress intervals are covered by current iteration.
+                    // depends on the current iteration time and time of each progress interval.
+                    // Previously covered progress intervals must be skipped.
+                    auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
+                    size_t newProgress = execTime / progressIntervalTime - progressCnt;
+                    progressBar.addProgress(newProgress);
+                    progressCnt += newProgress;
+                }
+            });
+            iteration = closedLoopResult.submitted;
         }
 
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        auto latencies = inferRequestsQueue.getLatencies();
+        double latency = getMedianValue<double>(latencies);
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
                      batchSize * 1000.0 * iteration / totalDuration;
 
+        // percentile -> latency and time spent waiting for an idle infer request
+        std::vector<std::pair<std::string, std::pair<double, double>>> latencyPercentiles;
+        auto inferenceRecords = inferRequestsQueue.getInferenceRecords();
+        auto percentiles = parseLatencyPercentiles(FLAGS_latency_percentiles);
+        if (!percentiles.empty() && !latencies.empty()) {
+            std::vector<double> idleWaitTimes;
+            for (const auto& record : inferenceRecords)
+                idleWaitTimes.push_back(record.idleWaitTime);
+            std::sort(latencies.begin(), latencies.end());
+            std::sort(idleWaitTimes.begin(), idleWaitTimes.end());
+            for (auto percentile : percentiles) {
+                std::stringstream name;
+                name << "p" << percentile;
+                latencyPercentiles.push_back({name.str(), {StatisticsReport::getPercentile(latencies, percentile),
+                                                           StatisticsReport::getPercentile(idleWaitTimes, percentile)}});
+            }
+        }
+
         if (statistics) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
@@ -610,11 +719,38 @@ int main(int argc, char *argv[]) {
                                           {
                                                   {"latency (ms)", double_to_string(latency)},
                                           });
+                for (auto& latencyPercentile : latencyPercentiles) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                      {"latency " + latencyPercentile.first + " (ms)",
+                                                       double_to_string(latencyPercentile.second.first)},
+                                                      {"idle request wait " + latencyPercentile.first + " (ms)",
+                                                       double_to_string(latencyPercentile.second.second)},
+                                              });
+                }
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
                                               {"throughput", double_to_string(fps)}
                                       });
+            for (auto& result : openLoopResults) {
+                std::sort(result.latencies.begin(), result.latencies.end());
+                const auto prefix = "arrival rate " + double_to_string(result.rate) + ": ";
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                                  {prefix + "throughput", double_to_string(result.getThroughput(batchSize))},
+                                                  {prefix + "submitted", std::to_string(result.submitted)},
+                                                  {prefix + "dropped", std::to_string(result.dropped)},
+                                                  {prefix + "late", std::to_string(result.late)},
+                                          });
+                if (!result.latencies.empty()) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                      {prefix + "latency p50 (ms)", double_to_string(StatisticsReport::getPercentile(result.latencies, 50))},
+                                                      {prefix + "latency p99 (ms)", double_to_string(StatisticsReport::getPercentile(result.latencies, 99))},
+                                              });
+                }
+            }
         }
 
         progressBar.finish();
@@ -654,14 +790,42 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        if (!FLAGS_timeline_path.empty()) {
+            StatisticsReport::dumpTimeline(FLAGS_timeline_path, inferenceRecords);
+        }
+
         if (statistics)
             statistics->dump();
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            for (auto& latencyPercentile : latencyPercentiles) {
+                auto label = latencyPercentile.first + ":";
+                label.resize(std::max<size_t>(label.size() + 1, 8), ' ');
+                std::cout << "    " << label << double_to_string(latencyPercentile.second.first) << " ms (idle request wait "
+                          << double_to_string(latencyPercentile.second.second) << " ms)" << std::endl;
+            }
+            if (FLAGS_latency_histogram) {
+                StatisticsReport::printLatencyHistogram(latencies, std::cout);
+            }
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (!openLoopResults.empty()) {
+            std::cout << "Open-loop results (" << FLAGS_arrival_distribution << " arrivals):" << std::endl;
+            for (auto& result : openLoopResults) {
+                std::sort(result.latencies.begin(), result.latencies.end());
+                std::cout << "    rate " << double_to_string(result.rate) << " inferences/s: throughput "
+                          << double_to_string(result.getThroughput(batchSize)) << " FPS, "
+                          << result.submitted << " submitted, " << result.dropped << " dropped, " << result.late << " late";
+                if (!result.latencies.empty()) {
+                    std::cout << ", latency p50 " << double_to_string(StatisticsReport::getPercentile(result.latencies, 50))
+                              << " ms, p99 " << double_to_string(StatisticsReport::getPercentile(result.latencies, 99)) << " ms";
+                }
+                std::cout << std::endl;
+            }
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -7,6 +7,9 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
 
 #include "statistics_report.hpp"
 
@@ -132,3 +135,85 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Performance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+double StatisticsReport::getPercentile(const std::vector<double> &sortedValues, double percentile) {
+    if (sortedValues.empty()) {
+        throw std::logic_error("Cannot calculate percentile of empty data");
+    }
+    auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sortedValues.size()));
+    rank = std::min(std::max(rank, static_cast<size_t>(1)), sortedValues.size());
+    return sortedValues[rank - 1];
+}
+
+void StatisticsReport::printLatencyHistogram(const std::vector<double> &latencies, std::ostream &stream) {
+    static constexpr int subBucketsCount = 4;
+    static constexpr size_t barWidth = 50;
+
+    // bucket index -> number of latencies; bucket 0 holds everything below 1 us
+    std::map<int, size_t> buckets;
+    for (auto latency : latencies) {
+        const double us = latency * 1000.0;
+        int index = 0;
+        if (us >= 1.0) {
+            int exponent = static_cast<int>(std::floor(std::log2(us)));
+            int subBucket = static_cast<int>((us / std::ldexp(1.0, exponent) - 1.0) * subBucketsCount);
+            index = 1 + exponent * subBucketsCount + std::min(subBucket, subBucketsCount - 1);
+        }
+        buckets[index]++;
+    }
+    if (buckets.empty())
+        return;
+
+    auto lowerBound = [] (int index) {
+        if (index == 0)
+            return 0.0;
+        const int exponent = (index - 1) / subBucketsCount;
+        const int subBucket = (index - 1) % subBucketsCount;
+        return std::ldexp(1.0, exponent) * (1.0 + static_cast<double>(subBucket) / subBucketsCount) / 1000.0;
+    };
+
+    size_t maxCount = 0;
+    for (const auto& bucket : buckets)
+        maxCount = std::max(maxCount, bucket.second);
+
+    const auto flags = stream.flags();
+    const auto precision = stream.precision();
+    stream << "Latency histogram (ms):" << std::endl;
+    for (int index = buckets.begin()->first; index <= buckets.rbegin()->first; index++) {
+        auto it = buckets.find(index);
+        const size_t count = it == buckets.end() ? 0 : it->second;
+        stream << "  [" << std::setw(10) << std::fixed << std::setprecision(3) << lowerBound(index)
+               << ", " << std::setw(10) << lowerBound(index + 1) << ") "
+               << std::setw(8) << count << " " << std::string(count * barWidth / maxCount, '#') << std::endl;
+    }
+    stream.flags(flags);
+    stream.precision(precision);
+}
+
+void StatisticsReport::dumpTimeline(const std::string &filename, const std::vector<InferenceRecord> &records) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Can't open file " + filename + " to dump the timeline");
+    }
+
+    // Thread 0 shows the time the application spent waiting for an idle infer request,
+    // thread N + 1 shows inferences executed by the N-th infer request
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [" << std::endl;
+    file << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": 0, "
+         << "\"args\": {\"name\": \"wait for idle request\"}}";
+    for (const auto& record : records) {
+        const double startUs = record.startTime * 1000.0;
+        if (record.idleWaitTime > 0.0) {
+            file << "," << std::endl << "{\"name\": \"wait\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, "
+                 << "\"ts\": " << startUs - record.idleWaitTime * 1000.0
+                 << ", \"dur\": " << record.idleWaitTime * 1000.0 << "}";
+        }
+        file << "," << std::endl << "{\"name\": \"infer\", \"ph\": \"X\", \"pid\": 0, "
+             << "\"tid\": " << record.requestId + 1 << ", \"ts\": " << startUs
+             << ", \"dur\": " << record.latency * 1000.0 << "}";
+    }
+    file << std::endl << "]}" << std::endl;
+
+    slog::info << "Inference timeline is stored to " << filename << slog::endl;
+}
@@ -8,6 +8,7 @@
 #include <vector>
 #include <utility>
 #include <map>
+#include <ostream>
 
 #include <inference_engine.hpp>
 #include <samples/common.hpp>
@@ -36,6 +37,14 @@ public:
         EXECUTION_RESULTS,
     };
 
+    /// @brief Timings of a single executed inference
+    struct InferenceRecord {
+        size_t requestId;
+        double startTime;     // submission time (ms) relative to the first submission
+        double idleWaitTime;  // time (ms) the application waited for an idle infer request before submission
+        double latency;       // time (ms) from submission to completion
+    };
+
     explicit StatisticsReport(Config config) : _config(std::move(config)) {
         _separator =
 #if defined _WIN32 || defined __CYGWIN__
@@ -57,6 +66,16 @@ public:
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
 
+    /// @brief Returns nearest-rank percentile of values sorted in ascending order
+    static double getPercentile(const std::vector<double> &sortedValues, double percentile);
+
+    /// @brief Prints latency histogram with log-linear buckets: each power-of-two range of microseconds
+    /// is split into the same number of equal sub-buckets, so relative resolution is kept for the tail
+    static void printLatencyHistogram(const std::vector<double> &latencies, std::ostream &stream);
+
+    /// @brief Dumps per-request timeline in Chrome trace event format (chrome://tracing, Perfetto)
+    static void dumpTimeline(const std::string &filename, const std::vector<InferenceRecord> &records);
+
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper,
                                         const PerformaceCounters& perfCounts);
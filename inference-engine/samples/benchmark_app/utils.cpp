@@ -9,6 +9,7 @@
 #include <map>
 #include <regex>
 #include <iostream>
+#include <thread>
 
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
@@ -19,6 +20,10 @@
 #include <opencv2/core.hpp>
 #endif
 
+#ifdef HAVE_IE_SYSTEM_CONF
+#include <ie_system_conf.h>
+#endif
+
 namespace benchmark_app {
     bool InputInfo::isImage() const {
         if ((layout != "NCHW") && (layout != "NHWC") &&
@@ -154,6 +159,54 @@ size_t getBatchSize(const benchmark_app::InputsInfo& inputs_info) {
     return batch_size;
 }
 
+namespace {
+std::vector<double> parseDoubleList(const std::string& values_string, const std::string& value_name) {
+    //  Format: <value1>,<value2>,...
+    std::vector<double> result;
+    for (auto& value_string : split(values_string, ',')) {
+        if (value_string.empty())
+            continue;
+        try {
+            result.push_back(std::stod(value_string));
+        } catch (const std::exception&) {
+            throw std::logic_error("Incorrect " + value_name + " value: " + value_string);
+        }
+    }
+    return result;
+}
+}  // namespace
+
+std::vector<double> parseLatencyPercentiles(const std::string& values_string) {
+    //  Format: <percentile1>,<percentile2>,... e.g. 50,90,99,99.9
+    auto result = parseDoubleList(values_string, "latency percentile");
+    for (auto value : result) {
+        if (value <= 0.0 || value > 100.0) {
+            throw std::logic_error("Latency percentile should be in (0, 100] range, got " + std::to_string(value));
+        }
+    }
+    return result;
+}
+
+std::vector<double> parseArrivalRates(const std::string& values_string) {
+    //  Format: <rate1>,<rate2>,... e.g. 100,200,400
+    auto result = parseDoubleList(values_string, "arrival rate");
+    for (auto value : result) {
+        if (value <= 0.0) {
+            throw std::logic_error("Arrival rate should be positive, got " + std::to_string(value));
+        }
+    }
+    return result;
+}
+
+uint32_t getNumberOfPhysicalCores() {
+#ifdef HAVE_IE_SYSTEM_CONF
+    return static_cast<uint32_t>(InferenceEngine::getNumberOfCPUCores());
+#else
+    // the Inference Engine development API is not available, count hardware threads as cores
+    return std::thread::hardware_concurrency();
+#endif
+}
+
 std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& shapes) {
     std::stringstream ss;
     for (auto& shape : shapes) {
@@ -29,6 +29,9 @@ std::vector<std::string> parseDevices(const std::string& device_string);
 uint32_t deviceDefaultDeviceDurationInSeconds(const std::string& device);
 std::map<std::string, std::string> parseNStreamsValuePerDevice(const std::vector<std::string>& devices,
                                                                const std::string& values_string);
+std::vector<double> parseLatencyPercentiles(const std::string& values_string);
+std::vector<double> parseArrivalRates(const std::string& values_string);
+uint32_t getNumberOfPhysicalCores();
 std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& shapes);
 size_t getBatchSize(const benchmark_app::InputsInfo& inputs_info);
 std::vector<std::string> split(const std::string &s, char delim);
@@ -0,0 +1,49 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <memory>
+#include <utility>
+
+#include "batch_async_infer_request.hpp"
+
+namespace BatchPlugin {
+    using namespace InferenceEngine;
+
+BatchAsyncInferRequest::BatchAsyncInferRequest(
+    const BatchInferRequest::Ptr&           inferRequest,
+    const BatchExecutableNetwork::Ptr&      batchExecutableNetwork,
+    const ITaskExecutor::Ptr&               callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _batchExecutableNetwork{batchExecutableNetwork},
+    _inferRequest{inferRequest} {
+    // this executor queues the request to the next batch while the task (checking the result) is called
+    // when the batch completes
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(BatchAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_batchExecutableNetwork->Enqueue(_this->_inferRequest.get(), std::move(task));
+        };
+        BatchAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        { /*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+              auto exception = _inferRequest->_exception;
+              _inferRequest->_exception = nullptr;
+              if (exception) {
+                  std::rethrow_exception(exception);
+              }
+        }}
+    };
+}
+
+void BatchAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+BatchAsyncInferRequest::~BatchAsyncInferRequest() {
+    StopAndWait();
+}
+
+}  // namespace BatchPlugin
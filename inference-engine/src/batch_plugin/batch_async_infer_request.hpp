@@ -0,0 +1,31 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <memory>
+
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include "batch_infer_request.hpp"
+#include "batch_exec_network.hpp"
+
+namespace BatchPlugin {
+
+class BatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<BatchAsyncInferRequest>;
+
+    explicit BatchAsyncInferRequest(const BatchInferRequest::Ptr&               inferRequest,
+                                    const BatchExecutableNetwork::Ptr&          batchExecutableNetwork,
+                                    const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    ~BatchAsyncInferRequest() override;
+
+protected:
+    BatchExecutableNetwork::Ptr     _batchExecutableNetwork;
+    BatchInferRequest::Ptr          _inferRequest;
+};
+
+}  // namespace BatchPlugin
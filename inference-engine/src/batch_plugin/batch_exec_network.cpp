@@ -0,0 +1,265 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ie_metric_helpers.hpp"
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include <batch/batch_config.hpp>
+#include <ie_plugin_config.hpp>
+#include "batch_exec_network.hpp"
+#include "batch_async_infer_request.hpp"
+
+// ------------------------------BatchExecutableNetwork----------------------------
+namespace BatchPlugin {
+    using namespace InferenceEngine;
+
+BatchExecutableNetwork::BatchExecutableNetwork(const ExecutableNetwork&                                 network,
+                                               const unsigned int                                       batchSize,
+                                               const std::chrono::milliseconds                          timeout,
+                                               const std::unordered_map<std::string, Parameter>&        config) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _network{network},
+    _batchSize{batchSize},
+    _timeout{timeout},
+    _config{config} {
+    _taskExecutor.reset();
+    unsigned int numRequests = 1;
+    try {
+        numRequests = std::max(1u, _network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+    } catch (const InferenceEngine::details::InferenceEngineException&) {
+    }
+    for (unsigned int i = 0; i < numRequests; ++i) {
+        _workerRequests.emplace_back(new WorkerInferRequest);
+        auto workerRequestPtr = _workerRequests.back().get();
+        workerRequestPtr->_inferRequest = _network.CreateInferRequest();
+        workerRequestPtr->_inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+            [workerRequestPtr, this] (InferRequest, StatusCode status) {
+                std::exception_ptr exception;
+                try {
+                    if (StatusCode::OK != status) {
+                        THROW_IE_EXCEPTION << InferenceEngine::details::as_status << status;
+                    }
+                    CopyOutputsFromBatch(*workerRequestPtr);
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+                Complete(*workerRequestPtr, exception);
+            });
+        _idleWorkerRequests.push_back(workerRequestPtr);
+    }
+    _collectorThread = std::thread{[this] { CollectBatches(); }};
+}
+
+BatchExecutableNetwork::~BatchExecutableNetwork() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminate = true;
+    }
+    _cv.notify_all();
+    if (_collectorThread.joinable()) {
+        _collectorThread.join();
+    }
+    /* NOTE: AsyncInferRequest destructor waits for all asynchronous tasks of the request,
+     *       so worker requests are destroyed when no batch is in flight
+     */
+    _workerRequests.clear();
+}
+
+void BatchExecutableNetwork::Enqueue(BatchInferRequest* request, Task task) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pendingRequests.push_back({request, std::move(task), std::chrono::steady_clock::now()});
+    }
+    _cv.notify_all();
+}
+
+void BatchExecutableNetwork::CollectBatches() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _cv.wait(lock, [&] { return _terminate || !_pendingRequests.empty(); });
+        if (_terminate) {
+            break;
+        }
+        // the first request waits for the rest of the batch not longer than the timeout
+        auto deadline = _pendingRequests.front()._arrivalTime + _timeout;
+        _cv.wait_until(lock, deadline, [&] { return _terminate || _pendingRequests.size() >= _batchSize; });
+        _cv.wait(lock, [&] { return _terminate || !_idleWorkerRequests.empty(); });
+        if (_terminate) {
+            break;
+        }
+        auto workerRequestPtr = _idleWorkerRequests.back();
+        _idleWorkerRequests.pop_back();
+        auto now = std::chrono::steady_clock::now();
+        auto numRequests = std::min<std::size_t>(_batchSize, _pendingRequests.size());
+        for (std::size_t i = 0; i < numRequests; ++i) {
+            auto& pendingRequest = _pendingRequests.front();
+            _queueingDelay += std::chrono::duration<double, std::milli>(now - pendingRequest._arrivalTime).count();
+            workerRequestPtr->_requests.push_back(pendingRequest._request);
+            workerRequestPtr->_tasks.push_back(std::move(pendingRequest._task));
+            _pendingRequests.pop_front();
+        }
+        _numBatches++;
+        _numBatchedRequests += numRequests;
+        lock.unlock();
+        try {
+            CopyInputsToBatch(*workerRequestPtr);
+            workerRequestPtr->_inferRequest.StartAsync();
+        } catch (...) {
+            Complete(*workerRequestPtr, std::current_exception());
+        }
+        lock.lock();
+    }
+}
+
+namespace {
+// A request blob must describe one item of the batched blob: the same precision and layout and
+// the same dimensions except for the batch one, which is 1 for the request blob
+void CheckBatchItemDesc(const TensorDesc& batchedDesc, const Blob::Ptr& blob,
+                        const std::string& name, const char* kind) {
+    auto memoryBlob = as<MemoryBlob>(blob);
+    if (memoryBlob == nullptr) {
+        THROW_IE_EXCEPTION << kind << " blob " << name << " of the BATCH device request should be a memory blob";
+    }
+    const auto& desc = memoryBlob->getTensorDesc();
+    auto itemDims = batchedDesc.getDims();
+    if (!itemDims.empty()) {
+        itemDims[0] = 1;
+    }
+    if (desc.getPrecision() != batchedDesc.getPrecision() ||
+        desc.getLayout() != batchedDesc.getLayout() ||
+        desc.getDims() != itemDims) {
+        THROW_IE_EXCEPTION << kind << " blob " << name << " of the BATCH device request has a tensor desc "
+                           << "(precision " << desc.getPrecision() << ", layout " << desc.getLayout()
+                           << ") which does not match an item of the batched blob (precision "
+                           << batchedDesc.getPrecision() << ", layout " << batchedDesc.getLayout() << ")";
+    }
+}
+}  // namespace
+
+void BatchExecutableNetwork::CopyInputsToBatch(WorkerInferRequest& workerRequest) {
+    for (auto&& input : _networkInputs) {
+        auto batchedBlob = as<MemoryBlob>(workerRequest._inferRequest.GetBlob(input.first));
+        IE_ASSERT(batchedBlob != nullptr);
+        auto itemSize = batchedBlob->byteSize() / _batchSize;
+        auto batchedMemory = batchedBlob->wmap();
+        for (std::size_t i = 0; i < workerRequest._requests.size(); ++i) {
+            // the request is in the BUSY state, so using the internal functions safely
+            auto requestBlob = workerRequest._requests[i]->GetBlob(input.first);
+            CheckBatchItemDesc(batchedBlob->getTensorDesc(), requestBlob, input.first, "Input");
+            auto blob = as<MemoryBlob>(requestBlob);
+            auto memory = blob->rmap();
+            std::memcpy(batchedMemory.as<std::uint8_t*>() + i * itemSize, memory.as<const std::uint8_t*>(), itemSize);
+        }
+    }
+}
+
+void BatchExecutableNetwork::CopyOutputsFromBatch(WorkerInferRequest& workerRequest) {
+    for (auto&& output : _networkOutputs) {
+        auto batchedBlob = as<MemoryBlob>(workerRequest._inferRequest.GetBlob(output.first));
+        IE_ASSERT(batchedBlob != nullptr);
+        auto itemSize = batchedBlob->byteSize() / _batchSize;
+        auto batchedMemory = batchedBlob->rmap();
+        for (std::size_t i = 0; i < workerRequest._requests.size(); ++i) {
+            auto requestBlob = workerRequest._requests[i]->GetBlob(output.first);
+            CheckBatchItemDesc(batchedBlob->getTensorDesc(), requestBlob, output.first, "Output");
+            auto blob = as<MemoryBlob>(requestBlob);
+            auto memory = blob->wmap();
+            std::memcpy(memory.as<std::uint8_t*>(), batchedMemory.as<const std::uint8_t*>() + i * itemSize, itemSize);
+        }
+    }
+}
+
+void BatchExecutableNetwork::Complete(WorkerInferRequest& workerRequest, std::exception_ptr exception) {
+    auto requests = std::move(workerRequest._requests);
+    auto tasks = std::move(workerRequest._tasks);
+    workerRequest._requests.clear();
+    workerRequest._tasks.clear();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _idleWorkerRequests.push_back(&workerRequest);
+    }
+    _cv.notify_all();
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        requests[i]->_exception = exception;
+        auto capturedTask = std::move(tasks[i]);
+        capturedTask();
+    }
+}
+
+InferenceEngine::InferRequestInternal::Ptr BatchExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                                          InferenceEngine::OutputsDataMap networkOutputs) {
+    return std::make_shared<BatchInferRequest>(networkInputs, networkOutputs);
+}
+
+IInferRequest::Ptr BatchExecutableNetwork::CreateInferRequest() {
+    IInferRequest::Ptr asyncRequest;
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncTreadSafeImpl = std::make_shared<BatchAsyncInferRequest>(std::static_pointer_cast<BatchInferRequest>(syncRequestImpl),
+                                                                       std::static_pointer_cast<BatchExecutableNetwork>(shared_from_this()),
+                                                                       _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase(asyncTreadSafeImpl), [](IInferRequest *p) { p->Release(); });
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+    return asyncRequest;
+}
+
+InferenceEngine::Parameter BatchExecutableNetwork::GetConfig(const std::string &name) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    } else {
+        // find config key among the device config keys
+        auto param = _network.GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        for (auto&& configKey : param.as<std::vector<std::string>>()) {
+            if (configKey == name) {
+                return _network.GetConfig(configKey);
+            }
+        }
+        THROW_IE_EXCEPTION << NOT_FOUND_str << name <<" not found in the ExecutableNetwork config";
+    }
+}
+
+InferenceEngine::Parameter BatchExecutableNetwork::GetMetric(const std::string &name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        // enough single requests to fill every batched request
+        unsigned int res = _batchSize * static_cast<unsigned int>(_workerRequests.size());
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res);
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _network.GetMetric(
+            METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == BATCH_METRIC_KEY(AVERAGE_BATCH_SIZE)) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        float res = _numBatches == 0 ? 0.f : static_cast<float>(_numBatchedRequests) / _numBatches;
+        IE_SET_METRIC_RETURN(BATCH_AVERAGE_BATCH_SIZE, res);
+    } else if (name == BATCH_METRIC_KEY(AVERAGE_QUEUEING_DELAY)) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        float res = _numBatchedRequests == 0 ? 0.f : static_cast<float>(_queueingDelay / _numBatchedRequests);
+        IE_SET_METRIC_RETURN(BATCH_AVERAGE_QUEUEING_DELAY, res);
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            BATCH_METRIC_KEY(AVERAGE_BATCH_SIZE),
+            BATCH_METRIC_KEY(AVERAGE_QUEUEING_DELAY)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = { BatchConfigParams::KEY_BATCH_DEVICE,
+                                                BatchConfigParams::KEY_BATCH_SIZE,
+                                                BatchConfigParams::KEY_BATCH_TIMEOUT };
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
+    }
+}
+
+}  // namespace BatchPlugin
@@ -0,0 +1,77 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp/ie_executable_network.hpp>
+#include "batch_infer_request.hpp"
+
+namespace BatchPlugin {
+
+class BatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<BatchExecutableNetwork>;
+    struct WorkerInferRequest {
+        InferenceEngine::InferRequest       _inferRequest;
+        std::vector<BatchInferRequest*>     _requests;
+        std::vector<InferenceEngine::Task>  _tasks;
+    };
+
+    explicit BatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&                           network,
+                                    const unsigned int                                                  batchSize,
+                                    const std::chrono::milliseconds                                     timeout,
+                                    const std::unordered_map<std::string, InferenceEngine::Parameter>&  config);
+
+    InferenceEngine::Parameter GetConfig(const std::string &name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string &name) const override;
+    InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
+    InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                      InferenceEngine::OutputsDataMap networkOutputs) override;
+    ~BatchExecutableNetwork() override;
+
+    // queues a single request, the task is called when the batch with the request completes
+    void Enqueue(BatchInferRequest* request, InferenceEngine::Task task);
+
+protected:
+    struct PendingRequest {
+        BatchInferRequest*                      _request;
+        InferenceEngine::Task                   _task;
+        std::chrono::steady_clock::time_point   _arrivalTime;
+    };
+
+    void CollectBatches();
+    void CopyInputsToBatch(WorkerInferRequest& workerRequest);
+    void CopyOutputsFromBatch(WorkerInferRequest& workerRequest);
+    void Complete(WorkerInferRequest& workerRequest, std::exception_ptr exception);
+
+    InferenceEngine::ExecutableNetwork                          _network;
+    const unsigned int                                          _batchSize;
+    const std::chrono::milliseconds                             _timeout;
+    std::unordered_map<std::string, InferenceEngine::Parameter> _config;
+    std::vector<std::unique_ptr<WorkerInferRequest>>            _workerRequests;
+    std::vector<WorkerInferRequest*>                            _idleWorkerRequests;
+    std::deque<PendingRequest>                                  _pendingRequests;
+    mutable std::mutex                                          _mutex;
+    std::condition_variable                                     _cv;
+    bool                                                        _terminate = false;
+    std::size_t                                                 _numBatches = 0;
+    std::size_t                                                 _numBatchedRequests = 0;
+    double                                                      _queueingDelay = 0.0;  // total in milliseconds
+    std::thread                                                 _collectorThread;
+};
+
+}  // namespace BatchPlugin
@@ -0,0 +1,37 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "batch_infer_request.hpp"
+
+namespace BatchPlugin {
+    using namespace InferenceEngine;
+// ------------------------------BatchInferRequest----------------------------
+BatchInferRequest::BatchInferRequest(const InputsDataMap&   networkInputs,
+                                     const OutputsDataMap&  networkOutputs)
+        : InferRequestInternal(networkInputs, networkOutputs) {
+    // Allocate all input blobs
+    for (const auto &it : networkInputs) {
+        Layout l = it.second->getLayout();
+        Precision p = it.second->getPrecision();
+        SizeVector dims = it.second->getTensorDesc().getDims();
+
+        TensorDesc desc = TensorDesc(p, dims, l);
+        _inputs[it.first] = make_blob_with_precision(desc);
+        _inputs[it.first]->allocate();
+    }
+    // Allocate all output blobs
+    for (const auto &it : networkOutputs) {
+        Layout l = it.second->getLayout();
+        Precision p = it.second->getPrecision();
+        SizeVector dims = it.second->getTensorDesc().getDims();
+
+        TensorDesc desc = TensorDesc(p, dims, l);
+        _outputs[it.first] = make_blob_with_precision(desc);
+        _outputs[it.first]->allocate();
+    }
+}
+
+}  // namespace BatchPlugin
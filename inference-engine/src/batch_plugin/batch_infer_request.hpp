@@ -0,0 +1,32 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <exception>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+
+namespace BatchPlugin {
+
+class BatchInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<BatchInferRequest>;
+    explicit BatchInferRequest(const InferenceEngine::InputsDataMap&    networkInputs,
+                               const InferenceEngine::OutputsDataMap&   networkOutputs);
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override {
+        THROW_IE_EXCEPTION_WITH_STATUS(NOT_IMPLEMENTED);
+    }
+    void InferImpl() override {
+        THROW_IE_EXCEPTION_WITH_STATUS(NOT_IMPLEMENTED);
+    }
+    // Batch impl specific: the error of the batched request this request was executed with
+    std::exception_ptr _exception;
+};
+
+}  // namespace BatchPlugin
@@ -0,0 +1,210 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+#include <unordered_map>
+
+
+#include <ie_metric_helpers.hpp>
+#include <batch/batch_config.hpp>
+#include <ie_icore.hpp>
+#include <ngraph/graph_util.hpp>
+#include "batch_plugin.hpp"
+
+// ------------------------------BatchInferencePlugin----------------------------
+namespace BatchPlugin {
+    using namespace InferenceEngine;
+namespace {
+    std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                    const std::map<std::string, std::string> & local) {
+        for (auto && kvp : local) {
+            config[kvp.first] = kvp.second;
+        }
+        return config;
+    }
+
+    unsigned int parseUnsigned(const std::map<std::string, std::string>& config, const std::string& key) {
+        auto it = config.find(key);
+        IE_ASSERT(it != config.end());
+        try {
+            auto value = std::stoi(it->second);
+            if (value >= 0) {
+                return static_cast<unsigned int>(value);
+            }
+        } catch (const std::exception&) {
+        }
+        THROW_IE_EXCEPTION << "Wrong value " << it->second << " for " << key << " key of the BATCH device";
+    }
+
+    // batched tensors are stacked along the leading dimension
+    bool hasLeadingBatch(const TensorDesc& desc) {
+        static const std::vector<Layout> layouts = {Layout::NCHW, Layout::NHWC, Layout::NCDHW, Layout::NDHWC, Layout::NC};
+        return std::find(layouts.begin(), layouts.end(), desc.getLayout()) != layouts.end() &&
+               !desc.getDims().empty() && desc.getDims()[0] == 1;
+    }
+}  // namespace
+
+BatchInferencePlugin::BatchInferencePlugin() {
+    _pluginName = "BATCH";
+    _config[BatchConfigParams::KEY_BATCH_SIZE] = "8";
+    _config[BatchConfigParams::KEY_BATCH_TIMEOUT] = "1";
+}
+
+std::map<std::string, std::string> BatchInferencePlugin::GetDeviceConfig(const std::map<std::string, std::string>& config,
+                                                                         std::string& deviceName) const {
+    auto itDevice = config.find(BatchConfigParams::KEY_BATCH_DEVICE);
+    if (itDevice == config.end() || itDevice->second.empty()) {
+        THROW_IE_EXCEPTION << "KEY_BATCH_DEVICE key is not set for BATCH device";
+    }
+    DeviceIDParser deviceParser(itDevice->second);
+    deviceName = deviceParser.getDeviceName();
+    auto tconfig = config;
+    // set device ID if any
+    std::string deviceIDLocal = deviceParser.getDeviceID();
+    if (!deviceIDLocal.empty()) {
+        tconfig[PluginConfigParams::KEY_DEVICE_ID] = deviceIDLocal;
+    }
+
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = tconfig.find(key);
+        if (tconfig.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+InferenceEngine::Parameter BatchInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    auto it = _config.find(name);
+    if (it == _config.end()) {
+        THROW_IE_EXCEPTION << "Unsupported config key: " << name;
+    }
+    return { it->second };
+}
+
+void BatchInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    for (auto && kvp : config) {
+        _config[kvp.first] = kvp.second;
+    }
+}
+
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "BatchPlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(BatchInferencePlugin, version)
+
+InferenceEngine::Parameter BatchInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string device_name = { "BATCH" };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = {
+            BatchConfigParams::KEY_BATCH_DEVICE,
+            BatchConfigParams::KEY_BATCH_SIZE,
+            BatchConfigParams::KEY_BATCH_TIMEOUT};
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported metric key " << name;
+    }
+}
+
+ExecutableNetworkInternal::Ptr BatchInferencePlugin::LoadExeNetworkImpl(const CNNNetwork &network,
+                                                                        const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    auto function = network.getFunction();
+    if (function == nullptr) {
+        THROW_IE_EXCEPTION << "BATCH device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    std::string deviceName;
+    auto deviceConfig = GetDeviceConfig(fullConfig, deviceName);
+    auto batchSize = parseUnsigned(fullConfig, BatchConfigParams::KEY_BATCH_SIZE);
+    auto timeout = parseUnsigned(fullConfig, BatchConfigParams::KEY_BATCH_TIMEOUT);
+    if (batchSize == 0) {
+        THROW_IE_EXCEPTION << "KEY_BATCH_SIZE key of the BATCH device should be positive";
+    }
+
+    // the device executes a copy of the network reshaped to the batch size
+    CNNNetwork batchedNetwork{ngraph::clone_function(*function)};
+    auto inputsInfo = network.getInputsInfo();
+    auto shapes = batchedNetwork.getInputShapes();
+    for (auto&& input : inputsInfo) {
+        if (!hasLeadingBatch(input.second->getTensorDesc())) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BATCH device supports only networks with batch 1 in the leading "
+                               << "dimension of inputs, but the input " << input.first << " has different layout or batch";
+        }
+        auto& preProcess = input.second->getPreProcess();
+        if (preProcess.getResizeAlgorithm() != ResizeAlgorithm::NO_RESIZE ||
+            preProcess.getColorFormat() != ColorFormat::RAW ||
+            preProcess.getMeanVariant() != MeanVariant::NONE) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BATCH device does not support pre-processing of the input "
+                               << input.first;
+        }
+        shapes.at(input.first)[0] = batchSize;
+    }
+    try {
+        batchedNetwork.reshape(shapes);
+    } catch (const std::exception& ex) {
+        THROW_IE_EXCEPTION << "BATCH device failed to reshape the network to batch " << batchSize << ": " << ex.what();
+    }
+    auto batchedInputsInfo = batchedNetwork.getInputsInfo();
+    for (auto&& input : inputsInfo) {
+        batchedInputsInfo.at(input.first)->setPrecision(input.second->getPrecision());
+        batchedInputsInfo.at(input.first)->setLayout(input.second->getLayout());
+    }
+    auto batchedOutputsInfo = batchedNetwork.getOutputsInfo();
+    for (auto&& output : network.getOutputsInfo()) {
+        auto itBatchedOutput = batchedOutputsInfo.find(output.first);
+        if (!hasLeadingBatch(output.second->getTensorDesc()) || itBatchedOutput == batchedOutputsInfo.end() ||
+            itBatchedOutput->second->getTensorDesc().getDims()[0] != batchSize) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BATCH device supports only networks with batch in the leading "
+                               << "dimension of outputs, but the output " << output.first << " has different layout or batch";
+        }
+        itBatchedOutput->second->setPrecision(output.second->getPrecision());
+        itBatchedOutput->second->setLayout(output.second->getLayout());
+    }
+
+    auto executableNetwork = GetCore()->LoadNetwork(batchedNetwork, deviceName, deviceConfig);
+
+    std::unordered_map<std::string, InferenceEngine::Parameter> batchNetworkConfig;
+    batchNetworkConfig.emplace(BatchConfigParams::KEY_BATCH_DEVICE, fullConfig.at(BatchConfigParams::KEY_BATCH_DEVICE));
+    batchNetworkConfig.emplace(BatchConfigParams::KEY_BATCH_SIZE, fullConfig.at(BatchConfigParams::KEY_BATCH_SIZE));
+    batchNetworkConfig.emplace(BatchConfigParams::KEY_BATCH_TIMEOUT, fullConfig.at(BatchConfigParams::KEY_BATCH_TIMEOUT));
+    return std::make_shared<BatchExecutableNetwork>(executableNetwork,
+                                                    batchSize,
+                                                    std::chrono::milliseconds{timeout},
+                                                    batchNetworkConfig);
+}
+
+QueryNetworkResult BatchInferencePlugin::QueryNetwork(const CNNNetwork&                         network,
+                                                      const std::map<std::string, std::string>& config) const {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    std::string deviceName;
+    auto deviceConfig = GetDeviceConfig(mergeConfigs(_config, config), deviceName);
+    auto queryResult = GetCore()->QueryNetwork(network, deviceName, deviceConfig);
+    queryResult.rc = StatusCode::OK;
+    return queryResult;
+}
+
+}  // namespace BatchPlugin
@@ -13,6 +13,7 @@
 #include <legacy/details/ie_cnn_network_tools.h>
 #include "layer_quantizer.hpp"
 #include "scale_factor_calc.hpp"
+#include "scale_factors_cache.hpp"
 #include "weights_converter.hpp"
 
 namespace GNAPluginNS {
@@ -37,8 +38,13 @@ class ModelQuantizer {
         return quantize(model, [](InferenceEngine::CNNNetwork &, bool runBeforeCopy){}, scaleFactor);
     }
 
+    /**
+     * @param cache - if set, scale factors search result is taken from or put to it
+     * @param configTag - configuration which affects scale factors and is not visible in the network itself
+     */
     template <class PreQuantisationCb>
-    InferenceEngine::CNNNetwork quantize(const InferenceEngine::CNNNetwork &model, const PreQuantisationCb &cb, std::vector<float> scaleFactor) const {
+    InferenceEngine::CNNNetwork quantize(const InferenceEngine::CNNNetwork &model, const PreQuantisationCb &cb, std::vector<float> scaleFactor,
+                                         const ScaleFactorsCache *cache = nullptr, const std::string &configTag = {}) const {
         auto visitor = [&](InferenceEngine::CNNLayerPtr lp) {
             auto newLayer = InferenceEngine::injectData<QuantizedLayerParams>(lp);
             transformLayer(newLayer, WeightsConverter());
@@ -77,7 +83,19 @@ class ModelQuantizer {
             scaleIndex++;
         }
 
-        propagateScaleFactor(sortedNewNet, T::mandatory().getWeightsPrecision().size());
+        const int weightsBytesSize = T::mandatory().getWeightsPrecision().size();
+        if (cache == nullptr) {
+            propagateScaleFactor(sortedNewNet, weightsBytesSize);
+        } else {
+            const auto key = ScaleFactorsCache::GetKey(sortedNewNet, scaleFactor,
+                                                       configTag + "_" + std::to_string(weightsBytesSize));
+            if (cache->Load(key, sortedNewNet)) {
+                gnalog() << "Scale factors loaded from cache entry " << key << std::endl;
+            } else {
+                propagateScaleFactor(sortedNewNet, weightsBytesSize);
+                cache->Store(key, sortedNewNet);
+            }
+        }
 
         // sorted order gives possibility for propagate quantisation along depended layers
         for (auto &&layer : sortedNewNet) {
@@ -0,0 +1,288 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include <file_utils.h>
+#include <legacy/layer_transform.hpp>
+
+#include "gna_plugin_log.hpp"
+#include "quantized_layer_params.hpp"
+#include "scale_factors_cache.hpp"
+
+using namespace InferenceEngine;
+
+namespace GNAPluginNS {
+
+namespace {
+// bumped whenever serialized layout or scale factors search changes in an incompatible way
+constexpr uint32_t kCacheFormatVersion = 2;
+constexpr uint32_t kCacheMagic = 0x46534e47;  // "GNSF"
+
+/**
+ * @brief 64-bit FNV-1a, stable across runs and platforms unlike std::hash
+ */
+class Hasher {
+ public:
+    void update(const void *data, size_t size) {
+        auto bytes = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i < size; i++) {
+            value ^= bytes[i];
+            value *= 0x100000001b3ULL;
+        }
+    }
+    void update(const std::string &str) {
+        update(static_cast<uint64_t>(str.size()));
+        update(str.data(), str.size());
+    }
+    template <class T>
+    void update(const T &pod) {
+        update(&pod, sizeof(pod));
+    }
+    uint64_t get() const {
+        return value;
+    }
+
+ private:
+    uint64_t value = 0xcbf29ce484222325ULL;
+};
+
+const Quantization &quantizationAt(const QuantizedLayerParams &params, int idx) {
+    switch (idx) {
+        case 0: return params._src_quant;
+        case 1: return params._dst_quant;
+        case 2: return params._weights_quant;
+        default: return params._bias_quant;
+    }
+}
+
+Quantization &quantizationAt(QuantizedLayerParams &params, int idx) {
+    return const_cast<Quantization &>(quantizationAt(static_cast<const QuantizedLayerParams &>(params), idx));
+}
+
+template <class T>
+bool readPod(std::istream &is, T &pod) {
+    return static_cast<bool>(is.read(reinterpret_cast<char *>(&pod), sizeof(pod)));
+}
+
+template <class T>
+void writePod(std::ostream &os, const T &pod) {
+    os.write(reinterpret_cast<const char *>(&pod), sizeof(pod));
+}
+
+bool readValues(std::istream &is, std::vector<float> &values) {
+    uint64_t size = 0;
+    if (!readPod(is, size)) {
+        return false;
+    }
+    values.resize(size);
+    return size == 0 || static_cast<bool>(is.read(reinterpret_cast<char *>(values.data()), size * sizeof(float)));
+}
+
+void writeValues(std::ostream &os, const std::vector<float> &values) {
+    writePod(os, static_cast<uint64_t>(values.size()));
+    os.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(float));
+}
+
+// the search copies whole Quantization objects between layers, so levels and FakeQuantize ranges are stored
+// together with scale factors, otherwise a cache hit would quantize with stale ranges
+bool readQuantization(std::istream &is, Quantization &quant) {
+    uint8_t scaleSet = 0;
+    float scale = 1.0f;
+    int32_t levels = 0;
+    std::vector<float> minValues, maxValues;
+    if (!readPod(is, scaleSet) || !readPod(is, scale) || !readPod(is, levels) ||
+        !readValues(is, minValues) || !readValues(is, maxValues)) {
+        return false;
+    }
+    quant = Quantization();
+    if (scaleSet) {
+        quant.SetScale(scale);
+    }
+    quant.SetLevels(levels);
+    quant.SetMinValues(minValues);
+    quant.SetMaxValues(maxValues);
+    return true;
+}
+
+void writeQuantization(std::ostream &os, const Quantization &quant) {
+    writePod(os, static_cast<uint8_t>(quant.IsScaleSet()));
+    writePod(os, quant.GetScale());
+    writePod(os, quant.GetLevels());
+    writeValues(os, quant.GetMinValues());
+    writeValues(os, quant.GetMaxValues());
+}
+
+bool readLayerParams(std::istream &is, QuantizedLayerParams &params) {
+    for (int q = 0; q != 4; q++) {
+        if (!readQuantization(is, quantizationAt(params, q))) {
+            return false;
+        }
+    }
+    uint8_t weightsQuantized = 0;
+    if (!readPod(is, weightsQuantized) || !readPod(is, params._o_shift) || !readPod(is, params._b_shift)) {
+        return false;
+    }
+    params._weights_quantized = weightsQuantized != 0;
+    return true;
+}
+
+void writeLayerParams(std::ostream &os, const QuantizedLayerParams &params) {
+    for (int q = 0; q != 4; q++) {
+        writeQuantization(os, quantizationAt(params, q));
+    }
+    writePod(os, static_cast<uint8_t>(params._weights_quantized));
+    writePod(os, params._o_shift);
+    writePod(os, params._b_shift);
+}
+}  // namespace
+
+std::string ScaleFactorsCache::GetKey(const std::vector<CNNLayerPtr> &net,
+                                      const std::vector<float> &inputScaleFactors,
+                                      const std::string &configTag) {
+    Hasher hasher;
+    hasher.update(kCacheFormatVersion);
+    hasher.update(configTag);
+    hasher.update(static_cast<uint64_t>(inputScaleFactors.size()));
+    for (auto &&scale : inputScaleFactors) {
+        hasher.update(scale);
+    }
+
+    hasher.update(static_cast<uint64_t>(net.size()));
+    for (auto &&layer : net) {
+        hasher.update(layer->name);
+        hasher.update(layer->type);
+        hasher.update(static_cast<uint64_t>(layer->params.size()));
+        for (auto &&param : layer->params) {
+            hasher.update(param.first);
+            hasher.update(param.second);
+        }
+        for (auto &&input : layer->insData) {
+            auto data = input.lock();
+            hasher.update(data ? data->getName() : std::string());
+        }
+        for (auto &&output : layer->outData) {
+            hasher.update(output->getName());
+            for (auto &&dim : output->getDims()) {
+                hasher.update(static_cast<uint64_t>(dim));
+            }
+        }
+        for (auto &&blob : layer->blobs) {
+            hasher.update(blob.first);
+            if (blob.second != nullptr) {
+                hasher.update(static_cast<uint64_t>(blob.second->byteSize()));
+                hasher.update(blob.second->cbuffer().as<const uint8_t *>(), blob.second->byteSize());
+            }
+        }
+        // FakeQuantize ranges are moved to quantization parameters before the search
+        if (auto quantParams = getInjectedData<QuantizedLayerParams>(layer)) {
+            for (int q = 0; q != 4; q++) {
+                const auto &quant = quantizationAt(*quantParams, q);
+                hasher.update(quant.IsScaleSet());
+                hasher.update(quant.GetScale());
+                hasher.update(quant.GetLevels());
+                hasher.update(static_cast<uint64_t>(quant.GetMinValues().size()));
+                hasher.update(quant.GetMinValues().data(), quant.GetMinValues().size() * sizeof(float));
+                hasher.update(static_cast<uint64_t>(quant.GetMaxValues().size()));
+                hasher.update(quant.GetMaxValues().data(), quant.GetMaxValues().size() * sizeof(float));
+            }
+        }
+    }
+
+    std::stringstream key;
+    key << std::hex << std::setw(16) << std::setfill('0') << hasher.get();
+    return key.str();
+}
+
+std::string ScaleFactorsCache::getFileName(const std::string &key) const {
+    return FileUtils::makePath(cacheDir, std::string("gna_sf_") + key + ".blob");
+}
+
+bool ScaleFactorsCache::Load(const std::string &key, const std::vector<CNNLayerPtr> &net) const {
+    std::ifstream is(getFileName(key), std::ios::binary);
+    if (!is.good()) {
+        return false;
+    }
+
+    uint32_t magic = 0, version = 0;
+    uint64_t numLayers = 0;
+    if (!readPod(is, magic) || !readPod(is, version) || !readPod(is, numLayers) ||
+        magic != kCacheMagic || version != kCacheFormatVersion || numLayers != net.size()) {
+        gnawarn() << "Ignoring malformed GNA scale factors cache entry " << key << std::endl;
+        return false;
+    }
+
+    std::unordered_map<std::string, QuantizedLayerParams> cached;
+    for (uint64_t i = 0; i != numLayers; i++) {
+        uint64_t nameLength = 0;
+        if (!readPod(is, nameLength)) {
+            return false;
+        }
+        std::string name(nameLength, '\0');
+        QuantizedLayerParams params;
+        if (!is.read(&name[0], nameLength) || !readLayerParams(is, params)) {
+            gnawarn() << "Ignoring truncated GNA scale factors cache entry " << key << std::endl;
+            return false;
+        }
+        cached[name] = params;
+    }
+
+    // first check that entry covers every layer so that a partially applied entry never leaks into the network
+    for (auto &&layer : net) {
+        if (!cached.count(layer->name) || getInjectedData<QuantizedLayerParams>(layer) == nullptr) {
+            return false;
+        }
+    }
+
+    for (auto &&layer : net) {
+        *getInjectedData<QuantizedLayerParams>(layer) = cached[layer->name];
+    }
+    return true;
+}
+
+void ScaleFactorsCache::Store(const std::string &key, const std::vector<CNNLayerPtr> &net) const {
+    const auto fileName = getFileName(key);
+    // written to a temporary file first so that concurrently loading processes never see a partial entry
+    const auto tmpFileName = fileName + ".tmp";
+    {
+        std::ofstream os(tmpFileName, std::ios::binary | std::ios::trunc);
+        if (!os.good()) {
+            gnawarn() << "Cannot write GNA scale factors cache entry " << fileName << std::endl;
+            return;
+        }
+
+        writePod(os, kCacheMagic);
+        writePod(os, kCacheFormatVersion);
+        writePod(os, static_cast<uint64_t>(net.size()));
+        for (auto &&layer : net) {
+            auto quantParams = getInjectedData<QuantizedLayerParams>(layer);
+            if (quantParams == nullptr) {
+                os.close();
+                std::remove(tmpFileName.c_str());
+                return;
+            }
+            writePod(os, static_cast<uint64_t>(layer->name.size()));
+            os.write(layer->name.data(), layer->name.size());
+            writeLayerParams(os, *quantParams);
+        }
+        if (!os.good()) {
+            gnawarn() << "Cannot write GNA scale factors cache entry " << fileName << std::endl;
+            os.close();
+            std::remove(tmpFileName.c_str());
+            return;
+        }
+    }
+    std::remove(fileName.c_str());
+    if (std::rename(tmpFileName.c_str(), fileName.c_str()) != 0) {
+        std::remove(tmpFileName.c_str());
+    }
+}
+
+}  // namespace GNAPluginNS
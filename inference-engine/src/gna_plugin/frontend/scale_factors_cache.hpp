@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <legacy/ie_layers.h>
+
+namespace GNAPluginNS {
+
+/**
+ * @brief persistent cache of per-layer scale factors found by ScaleFactorCalculator,
+ * keyed on a hash of the network passed to the search and of the quantization relevant configuration
+ */
+class ScaleFactorsCache {
+ public:
+    explicit ScaleFactorsCache(std::string cacheDir) : cacheDir(std::move(cacheDir)) {}
+
+    /**
+     * @brief computes the cache key of topologically sorted network with quantization parameters injected
+     * @param net - network layers as seen by scale factors search
+     * @param inputScaleFactors - scale factors of network inputs
+     * @param configTag - any other configuration the search result depends on
+     */
+    static std::string GetKey(const std::vector<InferenceEngine::CNNLayerPtr> &net,
+                              const std::vector<float> &inputScaleFactors,
+                              const std::string &configTag);
+
+    /**
+     * @brief sets quantization parameters of all layers of the network from cache
+     * @return false and leaves network untouched if there is no entry for the key or it does not cover every layer
+     */
+    bool Load(const std::string &key, const std::vector<InferenceEngine::CNNLayerPtr> &net) const;
+
+    /**
+     * @brief stores quantization parameters (scale factors, levels and ranges) of all layers of the network,
+     * failures are only logged
+     */
+    void Store(const std::string &key, const std::vector<InferenceEngine::CNNLayerPtr> &net) const;
+
+ private:
+    std::string getFileName(const std::string &key) const;
+
+    std::string cacheDir;
+};
+
+}  // namespace GNAPluginNS
@@ -17,6 +17,7 @@
 #include <memory>
 #include <utility>
 #include <limits>
+#include <chrono>
 
 #include <legacy/graph_tools.hpp>
 #include <cpp_interfaces/exception2status.hpp>
@@ -37,6 +38,7 @@
 #include "memory/gna_memory_state.hpp"
 #include "gna_model_serial.hpp"
 #include "runtime/gna_float_runtime.hpp"
+#include <threading/ie_cpu_streams_executor.hpp>
 #include <layers/gna_fake_quantize_layer.hpp>
 #include "gna_graph_patterns.hpp"
 
@@ -767,6 +769,14 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
         passIdx = passes->run(passIdx);
     };
 
+    // scale factors search result depends on network and on these options only
+    std::unique_ptr<ScaleFactorsCache> scaleFactorsCache;
+    if (!config.cacheDir.empty()) {
+        scaleFactorsCache.reset(new ScaleFactorsCache(config.cacheDir));
+    }
+    const auto quantConfigTag = std::string(config.gnaPrecision.name()) +
+        (gnaFlags->fake_quantized ? "_fq" : "") + (gnaFlags->uniformPwlDesign ? "_upwl" : "");
+
     InferenceEngine::CNNNetwork newNet;
     if (gnaFlags->sw_fp32) {
         auto visitor = [&](InferenceEngine::CNNLayerPtr lp) {
@@ -781,11 +791,13 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
         switch (config.gnaPrecision) {
             case Precision::I16:
                 ModelQuantizer<FakeQuantI16> q16;
-                newNet = q16.quantize(network, run_passes, inputsDesc->inputScaleFactors);
+                newNet = q16.quantize(network, run_passes, inputsDesc->inputScaleFactors,
+                                      scaleFactorsCache.get(), quantConfigTag);
                 break;
             case Precision::I8:
                 ModelQuantizer<FakeQuantI8> q8;
-                newNet = q8.quantize(network, run_passes, inputsDesc->inputScaleFactors);
+                newNet = q8.quantize(network, run_passes, inputsDesc->inputScaleFactors,
+                                     scaleFactorsCache.get(), quantConfigTag);
                 break;
             default:
                 THROW_GNA_EXCEPTION << "unsupported GNA precision for quantisation: " << config.gnaPrecision;
@@ -794,11 +806,13 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
         switch (config.gnaPrecision) {
             case Precision::I16:
                 ModelQuantizer<QuantI16> q16;
-                newNet = q16.quantize(network, run_passes, inputsDesc->inputScaleFactors);
+                newNet = q16.quantize(network, run_passes, inputsDesc->inputScaleFactors,
+                                      scaleFactorsCache.get(), quantConfigTag);
                 break;
             case Precision::I8:
                 ModelQuantizer<QuantI8> q8;
-                newNet = q8.quantize(network, run_passes, inputsDesc->inputScaleFactors);
+                newNet = q8.quantize(network, run_passes, inputsDesc->inputScaleFactors,
+                                     scaleFactorsCache.get(), quantConfigTag);
                 break;
             default:
                 THROW_GNA_EXCEPTION << "unsupported GNA precision for quantisation: " << config.gnaPrecision;
@@ -983,15 +997,23 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 #endif
     }
 
+    if (gnaFlags->sw_fp32 && !graphCompiler.dnnComponents.components.empty()) {
+        fp32Runtimes.push_back(std::make_shared<runtime::FP>(dnn));
+    }
+
     // creating same gna RW segment for parallel infer requests
     for (int i = 1; i != gnaFlags->gna_lib_async_threads_num; i++) {
 #if GNA_LIB_VER == 2
         gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
         // this can be improved by just copy all structures, but we are too lazy
-        dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj);
+        if (!gnaFlags->sw_fp32) {
+            dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj);
+        }
 #else
         nnets.emplace_back(make_shared<CPPWrapper<intel_nnet_type_t>>(), -1, InferenceEngine::BlobMap());
-        dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
+        if (!gnaFlags->sw_fp32) {
+            dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
+        }
 #endif
         // relocate rw pointers to new offset
         auto basePtr = reinterpret_cast<uint8_t*>(pParallelExecutionData) + rwSegmentSize * (i - 1);
@@ -1014,6 +1036,20 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
             relocate(outputsDesc[j].ptrs[i], outputsDesc[j].ptrs[0]);
         }
 
+        if (gnaFlags->sw_fp32) {
+            // fp32 runtime executes dnn components directly, so they are relocated instead of gna layers
+            auto components = dnn->component;
+            for (auto &comp : components) {
+                relocate(comp.ptr_inputs, comp.ptr_inputs);
+                relocate(comp.ptr_outputs, comp.ptr_outputs);
+                if (comp.operation == kDnnRecurrentOp) {
+                    relocate(comp.op.recurrent.ptr_feedbacks, comp.op.recurrent.ptr_feedbacks);
+                }
+            }
+            fp32Runtimes.push_back(std::make_shared<runtime::FP>(dnn, std::move(components)));
+            continue;
+        }
+
 #if GNA_LIB_VER == 2
         for (int j = 0; j != std::get<0>(gnaModels.front())->obj.NumberOfOperations; j++) {
             auto & gnaOperation = std::get<0>(gnaModels[i])->obj.Operations[j];
@@ -1086,6 +1122,11 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 #ifdef PLOT
     dnn->WriteGraphWizModel("gna-blob.dot");
 #endif
+    if (fp32Runtimes.size() > 1) {
+        fp32Requests.resize(fp32Runtimes.size());
+        fp32Executor = std::make_shared<InferenceEngine::CPUStreamsExecutor>(
+            InferenceEngine::IStreamsExecutor::Config{"GNAFP32Executor", static_cast<int>(fp32Runtimes.size()), 1});
+    }
 #if GNA_LIB_VER == 2
     createRequestConfigsForGnaModels();
 #endif
@@ -1094,7 +1135,11 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 #if GNA_LIB_VER == 2
 void GNAPlugin::createRequestConfigsForGnaModels() {
     if (!gnadevice || trivialTopology) {
-        gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        // software fp32 runtime can run one request per RW segment copy
+        const size_t numRequests = std::max<size_t>(fp32Runtimes.size(), 1);
+        for (size_t i = 0; i != numRequests; i++) {
+            gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        }
         return;
     }
     for (auto& model : gnaModels) {
@@ -1271,7 +1316,18 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
         ++inputNum;
     }
     // If there is no gnadevice infer using reference FP32 transforamtions
-    if (!gnadevice || trivialTopology) {
+    if (fp32Executor) {
+        // parallel fp32 requests are executed asynchronously, each on its own copy of RW segment
+        auto fp32Runtime = fp32Runtimes[idx];
+        auto task = std::make_shared<std::packaged_task<void()>>([fp32Runtime] {
+            fp32Runtime->infer();
+        });
+        fp32Requests[idx] = task->get_future();
+        fp32Executor->run([task] {
+            (*task)();
+        });
+        std::get<1>(*freeNnet) = 1;
+    } else if (!gnadevice || trivialTopology) {
         auto runtime = runtime::FP(dnn);
         runtime.infer();
         if (freeNnet != nnets.end()) {
@@ -1316,7 +1372,18 @@ GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
     // already synced TODO: might be copy required ???
     if (std::get<1>(nnets[request_idx]) == -1) return GNA_REQUEST_COMPLETED;
 
-    if (gnadevice && !trivialTopology) {
+    if (fp32Executor && fp32Requests[request_idx].valid()) {
+        if (fp32Requests[request_idx].wait_for(std::chrono::milliseconds(millisTimeout)) != std::future_status::ready) {
+            return GNA_REQUEST_PENDING;
+        }
+        auto request = std::move(fp32Requests[request_idx]);
+        try {
+            request.get();
+        } catch (...) {
+            std::get<1>(nnets[request_idx]) = -1;
+            throw;
+        }
+    } else if (gnadevice && !trivialTopology) {
         const auto waitStatus = gnadevice->wait(std::get<1>(nnets[request_idx]), millisTimeout);
         if (waitStatus == GNA_REQUEST_ABORTED) {
             std::get<1>(nnets[request_idx]) = -1;
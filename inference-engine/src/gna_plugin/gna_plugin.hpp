@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <future>
 #include <map>
 #include <unordered_map>
 #include <list>
@@ -13,6 +14,7 @@
 #include <vector>
 #include <tuple>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
+#include <threading/ie_itask_executor.hpp>
 #include "cpp_interfaces/impl/ie_variable_state_internal.hpp"
 #include "descriptions/gna_flags.hpp"
 #include "descriptions/gna_input_desc.hpp"
@@ -23,6 +25,7 @@
 #include "gna_plugin_policy.hpp"
 #include "gna_plugin_log.hpp"
 #include "gna_plugin_config.hpp"
+#include "runtime/gna_float_runtime.hpp"
 
 #if GNA_LIB_VER == 2
 #include <gna2-model-api.h>
@@ -81,6 +84,16 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
      */
     uint32_t rwSegmentSize = 0;
 
+    /**
+     * @brief software fp32 runtime per parallel infer request, each one works on its own copy of RW segment
+     */
+    std::vector<std::shared_ptr<GNAPluginNS::runtime::FP>> fp32Runtimes;
+    /**
+     * @brief completion of software fp32 infer requests running on fp32Executor
+     */
+    std::vector<std::future<void>> fp32Requests;
+    InferenceEngine::ITaskExecutor::Ptr fp32Executor;
+
     InferenceEngine::InputsDataMap inputsDataMap;
     InferenceEngine::OutputsDataMap outputsDataMap;
     std::vector<InferenceEngine::VariableStateInternal::Ptr> memoryStates;
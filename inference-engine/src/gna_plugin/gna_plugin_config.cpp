@@ -192,14 +192,12 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
                 log << "EXCLUSIVE_ASYNC_REQUESTS should be YES/NO, but not" << value;
                 THROW_GNA_EXCEPTION << "EXCLUSIVE_ASYNC_REQUESTS should be YES/NO, but not" << value;
             }
+        } else if (key == CONFIG_KEY(CACHE_DIR)) {
+            cacheDir = value;
         } else {
             THROW_GNA_EXCEPTION << as_status << NOT_FOUND << "Incorrect GNA Plugin config. Key " << item.first
                                 << " not supported";
         }
-
-        if (gnaFlags.sw_fp32 && gnaFlags.gna_lib_async_threads_num > 1) {
-            THROW_GNA_EXCEPTION << "GNA plugin does not support async mode on GNA_SW_FP32!";
-        }
     }
 
     if (inputScaleFactors.empty()) {
@@ -257,6 +255,7 @@ void Config::AdjustKeyMapValues() {
     keyConfigMap[GNA_CONFIG_KEY(LIB_N_THREADS)] = std::to_string(gnaFlags.gna_lib_async_threads_num);
     keyConfigMap[CONFIG_KEY(SINGLE_THREAD)] =
             gnaFlags.gna_openmp_multithreading ? PluginConfigParams::NO: PluginConfigParams::YES;
+    keyConfigMap[CONFIG_KEY(CACHE_DIR)] = cacheDir;
 }
 
 std::string Config::GetParameter(const std::string& name) const {
@@ -15,6 +15,7 @@
 #include <vector>
 #include <map>
 #include <mutex>
+#include <string>
 
 namespace GNAPluginNS {
 
@@ -34,6 +35,7 @@ struct Config {
 #endif
         inputScaleFactors = r.inputScaleFactors;
         gnaFlags = r.gnaFlags;
+        cacheDir = r.cacheDir;
         std::lock_guard<std::mutex>(r.mtx4keyConfigMap);
         keyConfigMap = r.keyConfigMap;
     }
@@ -58,6 +60,9 @@ struct Config {
     std::vector<float> inputScaleFactors;
     GNAFlags gnaFlags;
 
+    // directory for scale factors cache, caching is disabled if empty
+    std::string cacheDir;
+
     mutable std::mutex mtx4keyConfigMap;
     std::map<std::string, std::string> keyConfigMap;
 };
@@ -0,0 +1,48 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <immintrin.h>
+
+#include "floatmath_avx2.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx2 {
+
+float sdot(const uint32_t N, const float *X, const float *Y) {
+    uint32_t i = 0;
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    for (; i + 16 <= N; i += 16) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(X + i), _mm256_loadu_ps(Y + i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(X + i + 8), _mm256_loadu_ps(Y + i + 8), acc1);
+    }
+    for (; i + 8 <= N; i += 8) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(X + i), _mm256_loadu_ps(Y + i), acc0);
+    }
+    acc0 = _mm256_add_ps(acc0, acc1);
+    __m128 acc = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+    float sum = _mm_cvtss_f32(acc);
+    for (; i < N; i++) {
+        sum += X[i] * Y[i];
+    }
+    return sum;
+}
+
+void saxpy(const uint32_t N, const float alpha, const float *X, float *Y) {
+    uint32_t i = 0;
+    const __m256 a8 = _mm256_set1_ps(alpha);
+    for (; i + 8 <= N; i += 8) {
+        _mm256_storeu_ps(Y + i, _mm256_fmadd_ps(a8, _mm256_loadu_ps(X + i), _mm256_loadu_ps(Y + i)));
+    }
+    for (; i < N; i++) {
+        Y[i] += alpha * X[i];
+    }
+}
+
+}  // namespace avx2
+}  // namespace runtime
+}  // namespace GNAPluginNS
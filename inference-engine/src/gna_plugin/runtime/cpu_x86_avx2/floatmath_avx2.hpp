@@ -0,0 +1,24 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx2 {
+
+/**
+ * @brief AVX2 version of sdot, must be called only if the CPU supports AVX2 and FMA
+ */
+float sdot(const uint32_t N, const float *X, const float *Y);
+/**
+ * @brief AVX2 version of saxpy, must be called only if the CPU supports AVX2 and FMA
+ */
+void saxpy(const uint32_t N, const float alpha, const float *X, float *Y);
+
+}  // namespace avx2
+}  // namespace runtime
+}  // namespace GNAPluginNS
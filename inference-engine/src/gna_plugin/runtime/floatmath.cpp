@@ -1,18 +1,116 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines for software emulation mode
 //
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <exception>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define GNA_FLOATMATH_SSE2
+#endif
+
+#ifdef HAVE_AVX2
+#include <ie_system_conf.h>
+#include "cpu_x86_avx2/floatmath_avx2.hpp"
+#endif
 
 #include "floatmath.h"
 
+namespace {
+// number of output columns of C updated at once by the row-by-row (axpy) GEMM loops, chosen to keep
+// the accumulated part of C row in L1 cache while rows of B are streamed through it
+constexpr uint32_t kColumnsBlock = 1024;
+
+// GEMM with less output columns than this transposes B once and computes C as dot products of
+// contiguous rows, otherwise the axpy form is used which is contiguous in B and C
+constexpr MKL_INT kDotProductColumnsThreshold = 8;
+
+std::vector<float> &scratchBuffer(size_t size) {
+    // parallel infer requests run on their own threads, so the buffer is per thread
+    thread_local std::vector<float> buffer;
+    if (buffer.size() < size) {
+        buffer.resize(size);
+    }
+    return buffer;
+}
+
+// B (K x N, leading dimension ldb) -> Bt (N x K)
+const float *transposeToScratch(const float *B, MKL_INT K, MKL_INT N, MKL_INT ldb) {
+    auto &buffer = scratchBuffer(static_cast<size_t>(K) * N);
+    for (MKL_INT k = 0; k < K; k++) {
+        for (MKL_INT j = 0; j < N; j++) {
+            buffer[j * K + k] = B[k * ldb + j];
+        }
+    }
+    return buffer.data();
+}
+
+#ifdef HAVE_AVX2
+bool useAvx2() {
+    static const bool avx2 = InferenceEngine::with_cpu_x86_avx2();
+    return avx2;
+}
+#endif
+}  // namespace
+
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
 #endif
 
+float sdot(const uint32_t N, const float *X, const float *Y) {
+#ifdef HAVE_AVX2
+    if (useAvx2()) {
+        return GNAPluginNS::runtime::avx2::sdot(N, X, Y);
+    }
+#endif
+    uint32_t i = 0;
+    float sum = 0.0f;
+#if defined(GNA_FLOATMATH_SSE2)
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    for (; i + 8 <= N; i += 8) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(X + i), _mm_loadu_ps(Y + i)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(X + i + 4), _mm_loadu_ps(Y + i + 4)));
+    }
+    __m128 acc = _mm_add_ps(acc0, acc1);
+    for (; i + 4 <= N; i += 4) {
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(X + i), _mm_loadu_ps(Y + i)));
+    }
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+    sum = _mm_cvtss_f32(acc);
+#endif
+    for (; i < N; i++) {
+        sum += X[i] * Y[i];
+    }
+    return sum;
+}
+
+void saxpy(const uint32_t N, const float alpha, const float *X, float *Y) {
+#ifdef HAVE_AVX2
+    if (useAvx2()) {
+        GNAPluginNS::runtime::avx2::saxpy(N, alpha, X, Y);
+        return;
+    }
+#endif
+    uint32_t i = 0;
+#if defined(GNA_FLOATMATH_SSE2)
+    const __m128 a4 = _mm_set1_ps(alpha);
+    for (; i + 4 <= N; i += 4) {
+        _mm_storeu_ps(Y + i, _mm_add_ps(_mm_loadu_ps(Y + i), _mm_mul_ps(a4, _mm_loadu_ps(X + i))));
+    }
+#endif
+    for (; i < N; i++) {
+        Y[i] += alpha * X[i];
+    }
+}
+
 #ifdef _NO_MKL_
 void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                   const CBLAS_TRANSPOSE TransB, const MKL_INT M, const MKL_INT N,
@@ -27,34 +125,45 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        if (N < kDotProductColumnsThreshold) {
+            auto Bt = transposeToScratch(B, K, N, ldb);
+            for (i = 0; i < M; i++) {
+                for (j = 0; j < N; j++) {
+                    float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
+                    C[i * ldc + j] = sum + sdot(K, A + i * lda, Bt + j * K);
+                }
+            }
+        } else {
+            for (i = 0; i < M; i++) {
+                for (MKL_INT jb = 0; jb < N; jb += kColumnsBlock) {
+                    const MKL_INT nb = std::min<MKL_INT>(kColumnsBlock, N - jb);
+                    float *ptr_c = C + i * ldc + jb;
+                    if (beta != 1.0) {
+                        std::fill(ptr_c, ptr_c + nb, 0.0f);
+                    }
+                    for (k = 0; k < K; k++) {
+                        saxpy(nb, A[i * lda + k], B + k * ldb + jb, ptr_c);
+                    }
                 }
-                C[i * ldc + j] = sum;
             }
         }
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + j] = sum;
+                C[i * ldc + j] = beta * C[i * ldc + j] + alpha * sdot(K, A + i * lda, B + j * ldb);
             }
         }
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
         for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
+            for (MKL_INT jb = 0; jb < N; jb += kColumnsBlock) {
+                const MKL_INT nb = std::min<MKL_INT>(kColumnsBlock, N - jb);
+                float *ptr_c = C + i * ldc + jb;
+                if (beta != 1.0) {
+                    std::fill(ptr_c, ptr_c + nb, 0.0f);
+                }
                 for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
+                    saxpy(nb, A[k * lda + i], B + k * ldb + jb, ptr_c);
                 }
-                C[i * ldc + j] = sum;
             }
         }
     } else {
@@ -105,37 +214,43 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
+        if (N < kDotProductColumnsThreshold) {
+            auto Bt = transposeToScratch(B, K, N, ldb);
+            for (l = 0; l < L; l++) {
+                i = OutputList[l];
+                for (j = 0; j < N; j++) {
+                    float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
+                    C[l * ldc + j] = sum + sdot(K, A + i * lda, Bt + j * K);
+                }
+            }
+        } else {
+            for (l = 0; l < L; l++) {
+                i = OutputList[l];
+                float *ptr_c = C + l * ldc;
+                if (beta != 1.0) {
+                    std::fill(ptr_c, ptr_c + N, 0.0f);
+                }
                 for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+                    saxpy(N, A[i * lda + k], B + k * ldb, ptr_c);
                 }
-                C[l * ldc + j] = sum;
             }
         }
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
-                float sum;
                 j = OutputList[l];
-                sum = beta * C[i * ldc + l];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + l] = sum;
+                C[i * ldc + l] = beta * C[i * ldc + l] + alpha * sdot(K, A + i * lda, B + j * ldb);
             }
         }
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
         for (l = 0; l < L; l++) {
             i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
+            float *ptr_c = C + l * ldc;
+            if (beta != 1.0) {
+                std::fill(ptr_c, ptr_c + N, 0.0f);
+            }
+            for (k = 0; k < K; k++) {
+                saxpy(N, A[k * lda + i], B + k * ldb, ptr_c);
             }
         }
     } else {
@@ -155,17 +270,11 @@ void sgemv_split(const uint32_t N,
                  float *C) {
     uint32_t num_columns = K1 + K2;
     uint32_t num_rows = N;
-    uint32_t i, j;
+    uint32_t i;
 
     for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
+        const float *ptr_x = X + i * num_columns;
+        C[i] = B[i] + sdot(K1, A1, ptr_x) + sdot(K2, A2, ptr_x + K1);
     }
 }
 
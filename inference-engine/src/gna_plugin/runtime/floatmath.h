@@ -44,6 +44,14 @@ void cblas_ssbmv1(const CBLAS_LAYOUT Layout, const CBLAS_UPLO Uplo,
                   const MKL_INT lda, const float *X, const MKL_INT incX,
                   const float beta, float *Y, const MKL_INT incY);
 #endif  // #ifdef _NO_MKL_
+/**
+ * @brief vectorized dot product of X and Y of N elements, uses AVX2 if the CPU supports it and SSE2 otherwise
+ */
+float sdot(const uint32_t N, const float *X, const float *Y);
+/**
+ * @brief vectorized Y += alpha * X of N elements, uses AVX2 if the CPU supports it and SSE2 otherwise
+ */
+void saxpy(const uint32_t N, const float alpha, const float *X, float *Y);
 void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                         const CBLAS_TRANSPOSE TransB, const MKL_INT M, const MKL_INT N,
                         const MKL_INT K, const float alpha, const float *A,
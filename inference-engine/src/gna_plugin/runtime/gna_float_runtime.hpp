@@ -3,6 +3,8 @@
 //
 
 #pragma once
+#include <memory>
+#include <vector>
 #include <backend/am_intel_dnn.hpp>
 
 namespace GNAPluginNS {
@@ -12,9 +14,16 @@ namespace runtime {
  */
 class FP {
     std::shared_ptr<backend::AMIntelDNN> dnn;
+    /**
+     * components with pointers relocated to RW segment of a parallel infer request, dnn components are used if empty
+     */
+    std::vector<intel_dnn_component_t> components;
  public:
     FP(std::shared_ptr<backend::AMIntelDNN> dnn) : dnn(dnn) {
     }
+    FP(std::shared_ptr<backend::AMIntelDNN> dnn, std::vector<intel_dnn_component_t> components)
+        : dnn(dnn), components(std::move(components)) {
+    }
     virtual void infer();
 
     /**
@@ -19,7 +19,9 @@
 #include <memory>
 #include <unordered_set>
 #include <array>
+#include <set>
 #include <cstdint>
+#include <stdexcept>
 
 #include "transformations/serialize.hpp"
 #include "ie_ngraph_utils.hpp"
@@ -27,6 +29,7 @@
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include "hetero_plugin.hpp"
+#include "hetero_partitioner.hpp"
 
 #include <ngraph/function.hpp>
 #include <ngraph/variant.hpp>
@@ -78,13 +81,71 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         }
     }
 
+    auto itPartitioning = _config.find(HETERO_CONFIG_KEY(PARTITIONING));
+    bool costModelPartitioning = itPartitioning != _config.end() &&
+                                 itPartitioning->second == HETERO_CONFIG_VALUE(COST_MODEL);
+    if (itPartitioning != _config.end() && !costModelPartitioning &&
+        itPartitioning->second != HETERO_CONFIG_VALUE(PRIORITY)) {
+        THROW_IE_EXCEPTION << "Unsupported value " << itPartitioning->second << " for "
+                           << HETERO_CONFIG_KEY(PARTITIONING) << " option of heterogeneous plugin";
+    }
+    PartitionPlan partitionPlan;
+    std::size_t maxSubgraphs = 0;
     if (queryNetworkResult.supportedLayersMap.empty()) {
         auto it = _config.find("TARGET_FALLBACK");
-        if (it != _config.end()) {
-            queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
-        } else {
+        if (it == _config.end()) {
             THROW_IE_EXCEPTION << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
         }
+        if (costModelPartitioning) {
+            auto itMaxSubgraphs = _config.find(HETERO_CONFIG_KEY(MAX_SUBGRAPHS));
+            if (itMaxSubgraphs != _config.end()) {
+                try {
+                    maxSubgraphs = std::stoul(itMaxSubgraphs->second);
+                } catch (...) {
+                    THROW_IE_EXCEPTION << "Wrong value " << itMaxSubgraphs->second << " for "
+                                       << HETERO_CONFIG_KEY(MAX_SUBGRAPHS) << " option of heterogeneous plugin";
+                }
+            }
+            CostModel costModel;
+            auto itDeviceGops = _config.find(HETERO_CONFIG_KEY(DEVICE_GOPS));
+            if (itDeviceGops != _config.end()) {
+                try {
+                    for (auto&& deviceGops : DeviceIDParser::getHeteroDevices(itDeviceGops->second)) {
+                        auto separator = deviceGops.rfind(':');
+                        if (separator == std::string::npos) {
+                            throw std::invalid_argument{deviceGops};
+                        }
+                        auto device = deviceGops.substr(0, separator);
+                        costModel.deviceGops[device] = std::stod(deviceGops.substr(separator + 1));
+                    }
+                } catch (...) {
+                    THROW_IE_EXCEPTION << "Wrong value " << itDeviceGops->second << " for "
+                                       << HETERO_CONFIG_KEY(DEVICE_GOPS) << " option of heterogeneous plugin";
+                }
+            }
+            auto itTransferGBps = _config.find(HETERO_CONFIG_KEY(TRANSFER_GBPS));
+            if (itTransferGBps != _config.end()) {
+                try {
+                    costModel.transferGBps = std::stod(itTransferGBps->second);
+                } catch (...) {
+                    THROW_IE_EXCEPTION << "Wrong value " << itTransferGBps->second << " for "
+                                       << HETERO_CONFIG_KEY(TRANSFER_GBPS) << " option of heterogeneous plugin";
+                }
+            }
+            std::vector<std::string> fallbackDevices;
+            std::map<std::string, std::set<std::string>> supportedDevices;
+            for (auto&& deviceQueryResult : _heteroPlugin->QueryDevices(network, _config)) {
+                fallbackDevices.push_back(deviceQueryResult.first);
+                for (auto&& layerQueryResult : deviceQueryResult.second.supportedLayersMap) {
+                    supportedDevices[layerQueryResult.first].insert(deviceQueryResult.first);
+                }
+            }
+            partitionPlan = PartitionByCost(orderedOps, fallbackDevices, supportedDevices, costModel, maxSubgraphs);
+            // results, constants and parameters are assigned below to the device of their neighbours
+            queryNetworkResult.supportedLayersMap = partitionPlan.affinities;
+        } else {
+            queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
+        }
     }
 
     using Input = ngraph::Input<ngraph::Node>;
@@ -164,7 +225,12 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                         auto itLabel = std::find_if(std::begin(attributes), std::end(attributes), [] (const std::string& str) {
                             return str.find("label") != std::string::npos;
                         });
-                        auto label = "\\ndevice=" + queryNetworkResult.supportedLayersMap.at(node.get_friendly_name()) + '\"';
+                        auto label = "\\ndevice=" + queryNetworkResult.supportedLayersMap.at(node.get_friendly_name());
+                        auto itCost = partitionPlan.costs.find(node.get_friendly_name());
+                        if (itCost != partitionPlan.costs.end()) {
+                            label += "\\ncost=" + std::to_string(itCost->second) + "us";
+                        }
+                        label += '\"';
                         IE_ASSERT(itLabel != attributes.end());
                         itLabel->pop_back();
                         (*itLabel) += label;
@@ -364,6 +430,13 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         std::move(std::begin(nextSubgraphs), std::end(nextSubgraphs), std::back_inserter(orderedSubgraphs));
     } while (!allSubgraphs.empty());
 
+    // The partitioner counts device switches along the execution order, while subgraphs are connected components
+    // of operations with the same affinity, so parallel branches may still produce more of them
+    if (maxSubgraphs != 0 && orderedSubgraphs.size() > maxSubgraphs) {
+        THROW_IE_EXCEPTION << "Hetero plugin split the network into " << orderedSubgraphs.size()
+                           << " subgraphs, which exceeds " << HETERO_CONFIG_KEY(MAX_SUBGRAPHS) << " = " << maxSubgraphs;
+    }
+
     InputsDataMap externalInputsData = network.getInputsInfo();
     OutputsDataMap externalOutputsData = network.getOutputsInfo();
     networks.resize(orderedSubgraphs.size());
@@ -413,10 +486,70 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                 }
             }}.run_on_function(ngraph::clone_function(*function));
     }
-    for (auto&& network : networks) {
+    // Negotiate precision and layout of intermediate blobs, so a producer subgraph output blob is set to consumer
+    // subgraph requests with no conversion. Subgraphs are loaded starting from the last one, so consumers are loaded
+    // before their producer. A consumer input first gets the descriptor of the producer output and keeps its own one
+    // if the device rejects the former as not implemented, then the producer output gets the chosen descriptor
+    std::unordered_map<std::string, TensorDesc> intermediateDescs;
+    auto producerOutput = [&] (const std::string& outputName) {
+        for (auto&& producer : networks) {
+            auto outputs = producer._clonedNetwork.getOutputsInfo();
+            auto itOutput = outputs.find(outputName);
+            if (itOutput != outputs.end()) {
+                return itOutput->second;
+            }
+        }
+        THROW_IE_EXCEPTION << "Hetero plugin: no subgraph produces the intermediate blob " << outputName;
+    };
+    for (auto itNetwork = networks.rbegin(); itNetwork != networks.rend(); ++itNetwork) {
+        auto& network = *itNetwork;
+        for (auto&& output : network._clonedNetwork.getOutputsInfo()) {
+            auto itDesc = intermediateDescs.find(output.first);
+            if (itDesc != intermediateDescs.end()) {
+                output.second->setPrecision(itDesc->second.getPrecision());
+                output.second->setLayout(itDesc->second.getLayout());
+            }
+        }
+        auto inputs = network._clonedNetwork.getInputsInfo();
+        std::unordered_map<std::string, TensorDesc> ownDescs;
+        for (auto&& input : inputs) {
+            auto itOutputName = _blobNameMap.find(input.first);
+            if (itOutputName == _blobNameMap.end()) {
+                continue;
+            }
+            auto itDesc = intermediateDescs.find(itOutputName->second);
+            auto desc = itDesc != intermediateDescs.end() ? itDesc->second
+                                                          : producerOutput(itOutputName->second)->getTensorDesc();
+            if (itDesc == intermediateDescs.end()) {
+                ownDescs.emplace(input.first, input.second->getTensorDesc());
+            }
+            input.second->setPrecision(desc.getPrecision());
+            input.second->setLayout(desc.getLayout());
+        }
         auto metaDevices = _heteroPlugin->GetDevicePlugins(network._device, _config);
-        network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
-            network._device, metaDevices[network._device]);
+        auto loadNetwork = [&] {
+            network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
+                network._device, metaDevices[network._device]);
+        };
+        try {
+            loadNetwork();
+        } catch (const InferenceEngineException& ex) {
+            std::string message = ex.what();
+            if (ownDescs.empty() || message.find(NOT_IMPLEMENTED_str) == std::string::npos) {
+                throw;
+            }
+            for (auto&& ownDesc : ownDescs) {
+                inputs.at(ownDesc.first)->setPrecision(ownDesc.second.getPrecision());
+                inputs.at(ownDesc.first)->setLayout(ownDesc.second.getLayout());
+            }
+            loadNetwork();
+        }
+        for (auto&& input : inputs) {
+            auto itOutputName = _blobNameMap.find(input.first);
+            if (itOutputName != _blobNameMap.end()) {
+                intermediateDescs.emplace(itOutputName->second, input.second->getTensorDesc());
+            }
+        }
     }
 }
 
@@ -665,10 +798,20 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
             result = std::string{};
         }
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
+               name == HETERO_CONFIG_KEY(PIPELINED) ||
                name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING)) {
+        auto it = _config.find(name);
+        result = it != _config.end() ? it->second : std::string{HETERO_CONFIG_VALUE(PRIORITY)};
+    } else if (name == HETERO_CONFIG_KEY(MAX_SUBGRAPHS)) {
+        auto it = _config.find(name);
+        result = it != _config.end() ? static_cast<unsigned int>(std::stoul(it->second)) : 0u;
+    } else if (name == HETERO_CONFIG_KEY(DEVICE_GOPS) || name == HETERO_CONFIG_KEY(TRANSFER_GBPS)) {
+        auto it = _config.find(name);
+        result = it != _config.end() ? it->second : std::string{};
     } else {
         // find config key among plugin config keys
         for (auto&& desc : networks) {
@@ -687,6 +830,50 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
     return result;
 }
 
+std::uint64_t HeteroExecutableNetwork::GetEstimatedBytesCopiedPerInference() const {
+    // Intermediate blobs are shared by producer and consumer requests, but a device copies a blob to or from
+    // its own memory unless the subgraph executable network reports the input or output in ZERO_COPY_BLOBS
+    auto GetZeroCopyBlobs = [] (const ExecutableNetwork& network) {
+        std::vector<std::string> supportedMetrics = network.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+        if (std::find(supportedMetrics.begin(), supportedMetrics.end(), METRIC_KEY(ZERO_COPY_BLOBS))
+                == supportedMetrics.end()) {
+            return std::unordered_set<std::string>{};
+        }
+        auto blobNames = network.GetMetric(METRIC_KEY(ZERO_COPY_BLOBS)).as<std::vector<std::string>>();
+        return std::unordered_set<std::string>{blobNames.begin(), blobNames.end()};
+    };
+    std::vector<std::unordered_set<std::string>> zeroCopyBlobs;
+    for (auto&& desc : networks) {
+        zeroCopyBlobs.push_back(GetZeroCopyBlobs(desc._network));
+    }
+    std::uint64_t bytes = 0;
+    std::unordered_set<std::string> producerOutputs;
+    for (std::size_t consumer = 0; consumer < networks.size(); ++consumer) {
+        for (auto&& input : networks[consumer]._network.GetInputsInfo()) {
+            auto itOutputName = _blobNameMap.find(input.first);
+            if (itOutputName == _blobNameMap.end()) {
+                continue;
+            }
+            auto& inputDesc = input.second->getTensorDesc();
+            std::uint64_t blobBytes = details::product(inputDesc.getDims()) * inputDesc.getPrecision().size();
+            if (!contains(zeroCopyBlobs[consumer], input.first)) {
+                bytes += blobBytes;
+            }
+            if (!producerOutputs.insert(itOutputName->second).second) {
+                continue;
+            }
+            for (std::size_t producer = 0; producer < networks.size(); ++producer) {
+                auto outputs = networks[producer]._network.GetOutputsInfo();
+                if (contains(outputs, itOutputName->second) &&
+                    !contains(zeroCopyBlobs[producer], itOutputName->second)) {
+                    bytes += blobBytes;
+                }
+            }
+        }
+    }
+    return bytes;
+}
+
 using Metrics = std::map<std::string, Parameter>;
 
 namespace {
@@ -730,7 +917,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
             METRIC_KEY(NETWORK_NAME),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            HETERO_METRIC_KEY(ESTIMATED_BYTES_COPIED_PER_INFERENCE)
         };
 
         {
@@ -753,6 +941,11 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINED),
+            HETERO_CONFIG_KEY(PARTITIONING),
+            HETERO_CONFIG_KEY(MAX_SUBGRAPHS),
+            HETERO_CONFIG_KEY(DEVICE_GOPS),
+            HETERO_CONFIG_KEY(TRANSFER_GBPS),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -775,11 +968,17 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
     } else if (EXEC_NETWORK_METRIC_KEY(NETWORK_NAME) == name) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _name);
     } else if (EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
+        // in pipelined mode every subgraph needs its own requests in flight to keep all devices busy
+        auto itPipelined = _config.find(HETERO_CONFIG_KEY(PIPELINED));
+        bool pipelined = itPipelined != _config.end() && itPipelined->second == YES;
         unsigned int value = 0u;
         for (auto&& desc : networks) {
-            value = std::max(value, desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            auto subnetworkValue = desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+            value = pipelined ? value + subnetworkValue : std::max(value, subnetworkValue);
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
+    } else if (HETERO_METRIC_KEY(ESTIMATED_BYTES_COPIED_PER_INFERENCE) == name) {
+        IE_SET_METRIC_RETURN(HETERO_ESTIMATED_BYTES_COPIED_PER_INFERENCE, GetEstimatedBytesCopiedPerInference());
     } else {
         // find metric key among plugin metrics
         for (auto&& desc : networks) {
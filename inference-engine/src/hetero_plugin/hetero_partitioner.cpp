@@ -0,0 +1,241 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_partitioner.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+#include <ie_common.h>
+#include <details/ie_exception.hpp>
+
+#include <ngraph/op/convolution.hpp>
+#include <ngraph/op/group_conv.hpp>
+#include <ngraph/op/matmul.hpp>
+#include <ngraph/op/util/op_types.hpp>
+
+using namespace HeteroPlugin;
+
+namespace {
+
+bool IsPartitionedOp(const ngraph::Node* node) {
+    return !ngraph::op::is_parameter(node) && !ngraph::op::is_constant(node) && !ngraph::op::is_output(node);
+}
+
+double OutputElements(const ngraph::Node* node) {
+    double elements = 0;
+    for (auto&& output : node->outputs()) {
+        elements += output.get_partial_shape().is_static() ? ngraph::shape_size(output.get_shape()) : 1;
+    }
+    return std::max(elements, 1.0);
+}
+
+double OutputBytes(const ngraph::Output<ngraph::Node>& output) {
+    auto elements = output.get_partial_shape().is_static() ? ngraph::shape_size(output.get_shape()) : 1;
+    return static_cast<double>(elements * output.get_element_type().size());
+}
+
+// Number of multiply-accumulate operations for compute heavy operations and number of elements for the rest
+double EstimateWork(const ngraph::Node* node) {
+    auto work = OutputElements(node);
+    auto staticInputShape = [&] (std::size_t port) {
+        return node->get_input_partial_shape(port).is_static() ? node->get_input_shape(port) : ngraph::Shape{};
+    };
+    if (ngraph::is_type<ngraph::op::v1::Convolution>(node) ||
+        ngraph::is_type<ngraph::op::v1::ConvolutionBackpropData>(node)) {
+        // weights layout is [C_OUT, C_IN, spatial...] or [C_IN, C_OUT, spatial...], each output accumulates over the rest
+        auto weights = staticInputShape(1);
+        if (weights.size() > 1) {
+            work *= static_cast<double>(ngraph::shape_size(weights)) / weights[0];
+        }
+    } else if (ngraph::is_type<ngraph::op::v1::GroupConvolution>(node)) {
+        // weights layout is [GROUPS, C_OUT, C_IN, spatial...]
+        auto weights = staticInputShape(1);
+        if (weights.size() > 2) {
+            work *= static_cast<double>(ngraph::shape_size(weights)) / (weights[0] * weights[1]);
+        }
+    } else if (auto matMul = ngraph::as_type<const ngraph::op::v0::MatMul>(node)) {
+        auto input = staticInputShape(0);
+        if (!input.empty()) {
+            work *= static_cast<double>(input.size() > 1 && matMul->get_transpose_a() ? input[input.size() - 2] : input.back());
+        }
+    }
+    return work;
+}
+
+}  // namespace
+
+PartitionPlan HeteroPlugin::PartitionByCost(const std::vector<std::shared_ptr<ngraph::Node>>&       orderedOps,
+                                            const std::vector<std::string>&                         devices,
+                                            const std::map<std::string, std::set<std::string>>&     supportedDevices,
+                                            const CostModel&                                        costModel,
+                                            std::size_t                                             maxSubgraphs) {
+    constexpr double infinity = std::numeric_limits<double>::infinity();
+
+    std::vector<ngraph::Node*> ops;
+    std::unordered_map<ngraph::Node*, std::size_t> positions;
+    for (auto&& node : orderedOps) {
+        if (IsPartitionedOp(node.get())) {
+            positions.emplace(node.get(), ops.size());
+            ops.push_back(node.get());
+        }
+    }
+    PartitionPlan plan;
+    if (ops.empty() || devices.empty()) {
+        return plan;
+    }
+
+    // Bytes of tensors which are alive between an operation and the previous one
+    std::vector<double> liveBytes(ops.size() + 1, 0);
+    for (std::size_t i = 0; i < ops.size(); ++i) {
+        for (auto&& output : ops[i]->outputs()) {
+            std::size_t lastUse = i;
+            for (auto&& input : output.get_target_inputs()) {
+                auto itPosition = positions.find(input.get_node());
+                if (itPosition != positions.end()) {
+                    lastUse = std::max(lastUse, itPosition->second);
+                }
+            }
+            if (lastUse > i) {
+                auto bytes = OutputBytes(output);
+                liveBytes[i + 1] += bytes;
+                liveBytes[lastUse + 1] -= bytes;
+            }
+        }
+    }
+    for (std::size_t i = 1; i <= ops.size(); ++i) {
+        liveBytes[i] += liveBytes[i - 1];
+    }
+
+    const std::size_t deviceCount = devices.size();
+    auto isSupported = [&] (std::size_t op, std::size_t device) {
+        auto itSupported = supportedDevices.find(ops[op]->get_friendly_name());
+        return itSupported != supportedDevices.end() && itSupported->second.count(devices[device]) != 0;
+    };
+    for (std::size_t i = 0; i < ops.size(); ++i) {
+        bool supported = false;
+        for (std::size_t d = 0; d < deviceCount && !supported; ++d) {
+            supported = isSupported(i, d);
+        }
+        if (!supported) {
+            THROW_IE_EXCEPTION << "Hetero plugin cannot assign operation " << ops[i]->get_friendly_name()
+                               << " of type " << ops[i]->get_type_name()
+                               << ", because none of the fallback devices supports it";
+        }
+    }
+    if (!(costModel.transferGBps > 0)) {
+        THROW_IE_EXCEPTION << "Hetero plugin cost model needs a positive transfer bandwidth";
+    }
+    // Giga operations (bytes) per second are thousand operations (bytes) per microsecond
+    std::vector<double> usPerOp(deviceCount);
+    for (std::size_t d = 0; d < deviceCount; ++d) {
+        auto itGops = costModel.deviceGops.find(devices[d]);
+        auto gops = itGops != costModel.deviceGops.end() ? itGops->second : costModel.defaultGops;
+        if (!(gops > 0)) {
+            THROW_IE_EXCEPTION << "Hetero plugin cost model needs a positive throughput of " << devices[d] << " device";
+        }
+        usPerOp[d] = 1e-3 / gops;
+    }
+    const double usPerByte = 1e-3 / costModel.transferGBps;
+    auto opCost = [&] (std::size_t op, std::size_t device) {
+        if (!isSupported(op, device)) {
+            return infinity;
+        }
+        return EstimateWork(ops[op]) * usPerOp[device];
+    };
+
+    // Finds the best plan with at most segmentLimit subgraphs, or with any number of them if segmentLimit is 0.
+    // The previous device is stored for every state, so memory is proportional to ops * segmentLimit * devices.
+    auto solve = [&] (std::size_t segmentLimit) {
+        const bool limited = segmentLimit != 0;
+        // cost[segments][device] for the current operation; the segment dimension collapses when there is no limit
+        const std::size_t segments = limited ? segmentLimit : 1;
+        auto index = [&] (std::size_t op, std::size_t segment, std::size_t device) {
+            return (op * segments + segment) * deviceCount + device;
+        };
+        std::vector<double> cost(2 * segments * deviceCount, infinity);
+        // previous device for each state to restore the plan
+        std::vector<int> previousDevice(ops.size() * segments * deviceCount, -1);
+
+        auto current = [&] (std::size_t op, std::size_t segment, std::size_t device) -> double& {
+            return cost[((op % 2) * segments + segment) * deviceCount + device];
+        };
+        for (std::size_t d = 0; d < deviceCount; ++d) {
+            current(0, 0, d) = opCost(0, d);
+        }
+        for (std::size_t i = 1; i < ops.size(); ++i) {
+            for (std::size_t s = 0; s < segments; ++s) {
+                for (std::size_t d = 0; d < deviceCount; ++d) {
+                    auto compute = opCost(i, d);
+                    double best = infinity;
+                    int bestDevice = -1;
+                    if (compute != infinity) {
+                        for (std::size_t p = 0; p < deviceCount; ++p) {
+                            double candidate = infinity;
+                            if (p == d) {
+                                candidate = current(i - 1, s, p);
+                            } else if (!limited) {
+                                candidate = current(i - 1, s, p) + liveBytes[i] * usPerByte;
+                            } else if (s > 0) {
+                                candidate = current(i - 1, s - 1, p) + liveBytes[i] * usPerByte;
+                            }
+                            if (candidate < best) {
+                                best = candidate;
+                                bestDevice = static_cast<int>(p);
+                            }
+                        }
+                    }
+                    current(i, s, d) = best + compute;
+                    previousDevice[index(i, s, d)] = bestDevice;
+                }
+            }
+        }
+
+        const std::size_t last = ops.size() - 1;
+        double bestCost = infinity;
+        std::size_t segment = 0, device = 0;
+        for (std::size_t s = 0; s < segments; ++s) {
+            for (std::size_t d = 0; d < deviceCount; ++d) {
+                if (current(last, s, d) < bestCost) {
+                    bestCost = current(last, s, d);
+                    segment = s;
+                    device = d;
+                }
+            }
+        }
+        if (bestCost == infinity) {
+            THROW_IE_EXCEPTION << "Hetero plugin cannot assign operations to devices with at most " << segmentLimit
+                               << " subgraphs, because operations supported by different devices are interleaved";
+        }
+
+        PartitionPlan result;
+        result.totalCost = bestCost;
+        result.subgraphs = 1;
+        for (std::size_t i = last + 1; i-- > 0;) {
+            auto& name = ops[i]->get_friendly_name();
+            result.affinities[name] = devices[device];
+            result.costs[name] = opCost(i, device);
+            if (i == 0)
+                break;
+            auto prev = static_cast<std::size_t>(previousDevice[index(i, segment, device)]);
+            if (prev != device) {
+                ++result.subgraphs;
+                if (limited)
+                    --segment;
+            }
+            device = prev;
+        }
+        return result;
+    };
+
+    // The limit matters only if the best unlimited plan exceeds it. So the limited search runs with fewer segments
+    // than there are subgraphs in that plan, which keeps its memory bounded by the plan rather than the option value.
+    plan = solve(0);
+    if (maxSubgraphs != 0 && plan.subgraphs > maxSubgraphs) {
+        plan = solve(maxSubgraphs);
+    }
+    return plan;
+}
@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for cost model based affinity partitioning
+ * @file hetero_partitioner.hpp
+ */
+#pragma once
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <ngraph/node.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Parameters which put compute and transfer costs on a common time scale
+ */
+struct CostModel {
+    std::map<std::string, double>   deviceGops;         //!< device -> giga operations per second
+    double                          defaultGops = 100;  //!< giga operations per second of devices not in deviceGops
+    double                          transferGBps = 10;  //!< gigabytes per second transferred between devices
+};
+
+/**
+ * @brief Result of cost model based partitioning
+ */
+struct PartitionPlan {
+    std::map<std::string, std::string>  affinities;     //!< operation friendly name -> device
+    std::map<std::string, double>       costs;          //!< operation friendly name -> time on assigned device, us
+    double                              totalCost = 0;  //!< estimated latency including transfers, us
+    std::size_t                         subgraphs = 0;  //!< number of device switches along the execution order plus one
+};
+
+/**
+ * @brief Assigns devices to operations minimizing estimated end-to-end latency.
+ * Operations are considered in the execution order, so switching to another device at some operation moves
+ * all tensors which are alive at this point. All costs are estimated times in microseconds: an operation takes
+ * the number of its multiply-accumulate or element operations divided by the device throughput, a transfer takes
+ * the number of transferred bytes divided by the transfer bandwidth. Among plans with equal cost, the one which uses
+ * devices listed earlier in the fallback priority is chosen. Parameters, constants and results are not assigned
+ * and follow their neighbours.
+ * @param orderedOps Operations in the topological order
+ * @param devices Devices in the fallback priority order
+ * @param supportedDevices Operation friendly name -> devices which support this operation
+ * @param costModel Device throughputs and transfer bandwidth
+ * @param maxSubgraphs Limit for the number of subgraphs, 0 means no limit
+ * @return Partitioning plan
+ * @throws InferenceEngineException if an operation is not supported by any device or the limit can't be met
+ */
+PartitionPlan PartitionByCost(const std::vector<std::shared_ptr<ngraph::Node>>&       orderedOps,
+                              const std::vector<std::string>&                         devices,
+                              const std::map<std::string, std::set<std::string>>&     supportedDevices,
+                              const CostModel&                                        costModel,
+                              std::size_t                                             maxSubgraphs);
+
+}  // namespace HeteroPlugin
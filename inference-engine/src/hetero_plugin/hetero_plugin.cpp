@@ -23,8 +23,12 @@ using namespace HeteroPlugin;
 
 Engine::Engine() {
     _pluginName = "HETERO";
-    _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINED)] = NO;
+    _config[HETERO_CONFIG_KEY(PARTITIONING)] = HETERO_CONFIG_VALUE(PRIORITY);
+    _config[HETERO_CONFIG_KEY(MAX_SUBGRAPHS)] = "0";
+    _config[HETERO_CONFIG_KEY(DEVICE_GOPS)] = "";
+    _config[HETERO_CONFIG_KEY(TRANSFER_GBPS)] = "10";
 }
 
 namespace {
@@ -33,6 +37,18 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs & loc
     for (auto && kvp : local) {
         config[kvp.first] = kvp.second;
     }
+
+    // subgraphs of different infer requests overlap only if every subgraph gets its own executor on a device,
+    // so exclusive async requests are enabled by default only if execution is not pipelined
+    auto itPipelined = config.find(HETERO_CONFIG_KEY(PIPELINED));
+    bool pipelined = itPipelined != config.end() && itPipelined->second == YES;
+    auto itExclusive = config.find(KEY_EXCLUSIVE_ASYNC_REQUESTS);
+    if (itExclusive == config.end()) {
+        config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = pipelined ? NO : YES;
+    } else if (pipelined && itExclusive->second == YES) {
+        THROW_IE_EXCEPTION << "Heterogeneous plugin cannot use " << KEY_EXCLUSIVE_ASYNC_REQUESTS << "=" << YES
+                           << " together with " << HETERO_CONFIG_KEY(PIPELINED) << "=" << YES;
+    }
     return config;
 }
 
@@ -117,9 +133,7 @@ void Engine::SetConfig(const Configs &configs) {
     }
 }
 
-QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs& config) const {
-    QueryNetworkResult qr;
-
+Engine::DeviceQueryResults Engine::QueryDevices(const CNNNetwork &network, const Configs& config) const {
     if (GetCore() == nullptr) {
         THROW_IE_EXCEPTION << "Please, work with HETERO device via InferencEngine::Core object";
     }
@@ -147,8 +161,22 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs
     //  WARNING: Here is devices with user set priority
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
 
+    DeviceQueryResults deviceQueryResults;
     for (auto&& deviceName : fallbackDevices) {
-        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
+        auto itResult = queryResults.find(deviceName);
+        if (itResult != queryResults.end()) {
+            deviceQueryResults.emplace_back(deviceName, std::move(itResult->second));
+            queryResults.erase(itResult);
+        }
+    }
+    return deviceQueryResults;
+}
+
+QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs& config) const {
+    QueryNetworkResult qr;
+
+    for (auto&& deviceQueryResult : QueryDevices(network, config)) {
+        for (auto&& layerQueryResult : deviceQueryResult.second.supportedLayersMap) {
             qr.supportedLayersMap.emplace(layerQueryResult);
         }
     }
@@ -168,6 +196,11 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINED),
+            HETERO_CONFIG_KEY(PARTITIONING),
+            HETERO_CONFIG_KEY(MAX_SUBGRAPHS),
+            HETERO_CONFIG_KEY(DEVICE_GOPS),
+            HETERO_CONFIG_KEY(TRANSFER_GBPS),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)});
@@ -184,6 +217,23 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(PIPELINED)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PIPELINED));
+        IE_ASSERT(it != _config.end());
+        bool pipelined = it->second == YES;
+        return { pipelined };
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PARTITIONING));
+        IE_ASSERT(it != _config.end());
+        return { it->second };
+    } else if (name == HETERO_CONFIG_KEY(MAX_SUBGRAPHS)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(MAX_SUBGRAPHS));
+        IE_ASSERT(it != _config.end());
+        return { static_cast<unsigned int>(std::stoul(it->second)) };
+    } else if (name == HETERO_CONFIG_KEY(DEVICE_GOPS) || name == HETERO_CONFIG_KEY(TRANSFER_GBPS)) {
+        auto it = _config.find(name);
+        IE_ASSERT(it != _config.end());
+        return { it->second };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
@@ -270,6 +270,43 @@ TensorDesc verifyBatchedBlobInput(const std::vector<Blob::Ptr>& blobs) {
     return TensorDesc{subBlobDesc.getPrecision(), blobDims, blobLayout};
 }
 
+TensorDesc verifyVariableSizeBatchedBlobInput(const std::vector<Blob::Ptr>& blobs) {
+    // verify invariants
+    if (blobs.empty()) {
+        THROW_IE_EXCEPTION << "VariableSizeBatchedBlob cannot be created from empty vector of Blob, Please, make sure vector contains at least one Blob";
+    }
+
+    // Cannot create a compound blob from nullptr Blob objects
+    if (std::any_of(blobs.begin(), blobs.end(), [](const Blob::Ptr& blob) {
+            return blob == nullptr;
+        })) {
+        THROW_IE_EXCEPTION << "Cannot create a compound blob from nullptr Blob objects";
+    }
+
+    const auto subBlobDesc = getBlobTensorDesc(blobs[0]);
+    const auto subBlobLayout = subBlobDesc.getLayout();
+    if (subBlobLayout != NCHW && subBlobLayout != NHWC) {
+        THROW_IE_EXCEPTION << "Unsupported sub-blobs layout - to be one of: [NCHW, NHWC]";
+    }
+
+    // Images (e.g. ROIs of a frame) may have different spatial dimensions, the rest must be equal
+    const auto& subBlobDims = subBlobDesc.getDims();
+    if (std::any_of(blobs.begin(), blobs.end(),
+                    [&subBlobDesc, &subBlobDims](const Blob::Ptr& blob) {
+                        const auto desc = getBlobTensorDesc(blob);
+                        return desc.getPrecision() != subBlobDesc.getPrecision() ||
+                               desc.getLayout() != subBlobDesc.getLayout() ||
+                               desc.getDims()[0] != 1 ||
+                               desc.getDims()[1] != subBlobDims[1];
+                    })) {
+        THROW_IE_EXCEPTION << "All blobs should be batch 1 and have equal precisions, layouts and numbers of channels";
+    }
+
+    SizeVector blobDims = subBlobDims;
+    blobDims[0] = blobs.size();
+    return TensorDesc{subBlobDesc.getPrecision(), blobDims, subBlobLayout};
+}
+
 }  // anonymous namespace
 
 CompoundBlob::CompoundBlob(const TensorDesc& tensorDesc): Blob(tensorDesc) {}
@@ -472,4 +509,14 @@ BatchedBlob::BatchedBlob(std::vector<Blob::Ptr>&& blobs)
     this->_blobs = std::move(blobs);
 }
 
+VariableSizeBatchedBlob::VariableSizeBatchedBlob(const std::vector<Blob::Ptr>& blobs)
+    : CompoundBlob(verifyVariableSizeBatchedBlobInput(blobs)) {
+    this->_blobs = blobs;
+}
+
+VariableSizeBatchedBlob::VariableSizeBatchedBlob(std::vector<Blob::Ptr>&& blobs)
+    : CompoundBlob(verifyVariableSizeBatchedBlobInput(blobs)) {
+    this->_blobs = std::move(blobs);
+}
+
 }  // namespace InferenceEngine
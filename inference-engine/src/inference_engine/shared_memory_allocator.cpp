@@ -0,0 +1,119 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_memory_allocator.hpp"
+
+#ifndef _WIN32
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <utility>
+
+namespace InferenceEngine {
+
+IAllocator* CreateSharedMemoryAllocator(const char* name, bool create, size_t offset) noexcept {
+#ifndef _WIN32
+    try {
+        std::string objectName = name ? name : "";
+        if (objectName.empty() && !create) {
+            return nullptr;
+        }
+        return new SharedMemoryAllocator(std::move(objectName), create, offset);
+    } catch (...) {
+        return nullptr;
+    }
+#else
+    return nullptr;
+#endif
+}
+
+}  // namespace InferenceEngine
+
+#ifndef _WIN32
+
+SharedMemoryAllocator::SharedMemoryAllocator(std::string name, bool create, size_t offset)
+    : _name(std::move(name)), _create(create), _offset(create ? 0 : offset) {}
+
+int SharedMemoryAllocator::openObject(size_t size) const noexcept {
+    if (!_create) {
+        int fd = shm_open(_name.c_str(), O_RDWR, 0);
+        struct stat info = {};
+        // mapping beyond the end of the object would fail with SIGBUS on first access
+        if (fd >= 0 && (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < _offset + size)) {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    int fd = shm_open(_name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd >= 0 && ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        close(fd);
+        shm_unlink(_name.c_str());
+        return -1;
+    }
+    return fd;
+}
+
+void* SharedMemoryAllocator::alloc(size_t size) noexcept {
+    // mmap does not accept empty mappings, but other allocators return valid handles for them
+    size = std::max<size_t>(size, 1);
+
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t alignedOffset = _offset - _offset % pageSize;
+    const size_t mappedSize = size + (_offset - alignedOffset);
+
+    void* base = MAP_FAILED;
+    if (_name.empty()) {
+        base = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    } else {
+        int fd = openObject(size);
+        if (fd < 0) {
+            return nullptr;
+        }
+        base = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, static_cast<off_t>(alignedOffset));
+        // the mapping keeps the object alive
+        close(fd);
+        if (base == MAP_FAILED && _create) {
+            shm_unlink(_name.c_str());
+        }
+    }
+    if (base == MAP_FAILED) {
+        return nullptr;
+    }
+
+    try {
+        return new Region {base, mappedSize, static_cast<char*>(base) + (_offset - alignedOffset)};
+    } catch (...) {
+        munmap(base, mappedSize);
+        if (_create && !_name.empty()) {
+            shm_unlink(_name.c_str());
+        }
+        return nullptr;
+    }
+}
+
+void* SharedMemoryAllocator::lock(void* handle, InferenceEngine::LockOp) noexcept {
+    return handle ? static_cast<Region*>(handle)->data : nullptr;
+}
+
+bool SharedMemoryAllocator::free(void* handle) noexcept {
+    if (handle == nullptr) {
+        return true;
+    }
+    auto region = static_cast<Region*>(handle);
+    bool released = munmap(region->base, region->mappedSize) == 0;
+    // processes which already mapped the object keep their mappings
+    if (_create && !_name.empty()) {
+        released = shm_unlink(_name.c_str()) == 0 && released;
+    }
+    delete region;
+    return released;
+}
+
+#endif  // _WIN32
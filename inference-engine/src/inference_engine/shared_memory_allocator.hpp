@@ -0,0 +1,47 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+#include "ie_allocator.hpp"
+
+/**
+ * @brief Allocator placing memory into POSIX shared memory, every alloc() maps a separate shared memory object
+ */
+class SharedMemoryAllocator : public InferenceEngine::IAllocator {
+public:
+    /**
+     * @param name Name of the shared memory object as for shm_open(), empty for anonymous shared memory
+     * @param create Whether alloc() creates the object or maps an existing one
+     * @param offset Offset of the mapped memory in an existing object
+     */
+    SharedMemoryAllocator(std::string name, bool create, size_t offset);
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override;
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+private:
+    struct Region {
+        void* base;
+        size_t mappedSize;
+        void* data;
+    };
+
+    int openObject(size_t size) const noexcept;
+
+    std::string _name;
+    bool _create;
+    size_t _offset;
+};
@@ -65,6 +65,12 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_PERF_COUNT
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_FOLD_PREPROCESSING) {
+            if (val == PluginConfigParams::YES) foldPreprocessing = true;
+            else if (val == PluginConfigParams::NO) foldPreprocessing = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_FOLD_PREPROCESSING
+                                   << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS) {
             if (val == PluginConfigParams::YES) exclusiveAsyncRequests = true;
             else if (val == PluginConfigParams::NO) exclusiveAsyncRequests = false;
@@ -149,6 +155,10 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        if (foldPreprocessing)
+            _config.insert({ PluginConfigParams::KEY_CPU_FOLD_PREPROCESSING, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_FOLD_PREPROCESSING, PluginConfigParams::NO });
     }
 }
 
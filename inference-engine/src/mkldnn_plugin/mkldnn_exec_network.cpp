@@ -13,6 +13,7 @@
 #include "mkldnn_itt.h"
 #include "nodes/mkldnn_memory_node.hpp"
 #include "bf16transformer.h"
+#include "preprocess_folding.h"
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
 #include <threading/ie_executor_manager.hpp>
@@ -44,10 +45,16 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()} {
-    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
+    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "takeNetwork");
 
-    // we are cloning network if we have statistics and we can transform network.
-    _clonedNetwork = cloneNetwork(network);
+    // The plugin passes a private copy of the user's network which was already cloned and converted
+    // by Engine::LoadExeNetworkImpl, so it is taken over as is instead of being cloned one more time.
+    _clonedNetwork = network;
+
+    if (_cfg.foldPreprocessing) {
+        OV_ITT_TASK_NEXT(taskChain, "FoldInputPreprocessing");
+        FoldInputPreprocessing(_clonedNetwork);
+    }
 
     if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
         // Check if network is INT8 or Binary.
@@ -306,6 +313,7 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(ZERO_COPY_BLOBS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -320,6 +328,23 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(ZERO_COPY_BLOBS)) {
+        // the same conditions as MKLDNNInferRequest::SetBlob uses to bind external memory to the graph
+        auto graph = _graphs.begin()->get();
+        std::vector<std::string> blobNames;
+        if (!graph->getProperty().batchLimit) {
+            for (auto&& input : _networkInputs) {
+                if (input.second->getPrecision() == Precision::FP32 && !graph->hasMeanImageFor(input.first)) {
+                    blobNames.push_back(input.first);
+                }
+            }
+            for (auto&& output : _networkOutputs) {
+                if (output.second->getPrecision() == Precision::FP32) {
+                    blobNames.push_back(output.first);
+                }
+            }
+        }
+        IE_SET_METRIC_RETURN(ZERO_COPY_BLOBS, blobNames);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
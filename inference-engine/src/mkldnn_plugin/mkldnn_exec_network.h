@@ -29,6 +29,10 @@ public:
 
     InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
 
+    /**
+     * @param network A network owned by the executable network. It is modified in place, so callers
+     *        must pass a private copy rather than the network provided by the user.
+     */
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                       const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
 
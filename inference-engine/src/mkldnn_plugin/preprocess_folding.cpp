@@ -0,0 +1,119 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "preprocess_folding.h"
+
+#include <legacy/ie_layers.h>
+#include <legacy/ie_layers_internal.hpp>
+#include <legacy/graph_tools.hpp>
+#include <caseless.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+bool hasZeroPaddings(const ConvolutionLayer &conv) {
+    auto paddings = getPaddings(conv);
+    for (size_t i = 0; i < paddings.begin.size(); i++) {
+        if (paddings.begin[i] != 0 || paddings.end[i] != 0)
+            return false;
+    }
+    return true;
+}
+
+bool isFP32(const Blob::Ptr &blob) {
+    return blob && blob->getTensorDesc().getPrecision() == Precision::FP32;
+}
+
+bool hasUnitScales(const PreProcessInfo &preProcess) {
+    for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+        if (preProcess[c]->stdScale != 1.f)
+            return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+size_t FoldInputPreprocessing(CNNNetwork &network) {
+    size_t folded = 0;
+    for (auto &input : network.getInputsInfo()) {
+        auto &preProcess = input.second->getPreProcess();
+        // MeanImage applies only mean values, so inputs with scales are left as they are to keep
+        // results the same with and without folding
+        if (preProcess.getMeanVariant() != MEAN_VALUE || !hasUnitScales(preProcess))
+            continue;
+
+        auto data = input.second->getInputData();
+        const auto &dims = data->getTensorDesc().getDims();
+        const size_t channels = preProcess.getNumberOfChannels();
+        if ((dims.size() != 4 && dims.size() != 5) || dims[1] != channels)
+            continue;
+
+        auto &consumers = getInputTo(data);
+        if (consumers.size() != 1)
+            continue;
+
+        auto *conv = dynamic_cast<ConvolutionLayer *>(consumers.begin()->second.get());
+        if (conv == nullptr || !details::CaselessEq<std::string>()(conv->type, "Convolution") ||
+            conv->insData.size() != 1 || !hasZeroPaddings(*conv))
+            continue;
+
+        Blob::Ptr weights = conv->blobs["weights"];
+        Blob::Ptr biases = conv->blobs.count("biases") ? conv->blobs["biases"] : nullptr;
+        if (!isFP32(weights) || (biases && !isFP32(biases)))
+            continue;
+
+        const size_t groups = conv->_group;
+        const size_t outChannels = conv->_out_depth;
+        if (groups == 0 || channels % groups != 0 || outChannels % groups != 0)
+            continue;
+        const size_t groupIC = channels / groups;
+        const size_t groupOC = outChannels / groups;
+        if (weights->size() % (outChannels * groupIC) != 0)
+            continue;
+        const size_t kernelSize = weights->size() / (outChannels * groupIC);
+
+        // The biases may be shared with the user's network, so the folded values are written to a new blob
+        auto newBiases = make_shared_blob<float>({Precision::FP32, {outChannels}, Layout::C});
+        newBiases->allocate();
+
+        const float *src = weights->cbuffer().as<const float *>();
+        float *bias = newBiases->buffer().as<float *>();
+        if (biases) {
+            const float *srcBias = biases->cbuffer().as<const float *>();
+            std::copy(srcBias, srcBias + outChannels, bias);
+        } else {
+            std::fill(bias, bias + outChannels, 0.f);
+        }
+
+        // conv(x - mean) == conv'(x) with b' = b - sum(w * mean)
+        for (size_t oc = 0; oc < outChannels; oc++) {
+            const size_t g = oc / groupOC;
+            float shift = 0.f;
+            for (size_t ic = 0; ic < groupIC; ic++) {
+                const float meanValue = preProcess[g * groupIC + ic]->meanValue;
+                const size_t offset = (oc * groupIC + ic) * kernelSize;
+                for (size_t k = 0; k < kernelSize; k++)
+                    shift += src[offset + k] * meanValue;
+            }
+            bias[oc] -= shift;
+        }
+
+        conv->blobs["biases"] = newBiases;
+        conv->_biases = newBiases;
+
+        preProcess.init(0);
+        preProcess.setVariant(NONE);
+        folded++;
+    }
+    return folded;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,24 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Folds per-channel mean values of network inputs into the biases of the convolution which is the
+ * only consumer of the input. Pre-processing of folded inputs is reset, so raw input data is read
+ * directly by the convolution instead of being converted and normalized by separate passes. Inputs
+ * which can't be folded keep their pre-processing.
+ *
+ * Folding is exact only if the convolution has no padding, so padded convolutions are skipped. Inputs
+ * with scales other than 1 are skipped too, since the plugin doesn't apply them without folding.
+ *
+ * @return Number of folded inputs
+ */
+size_t FoldInputPreprocessing(InferenceEngine::CNNNetwork &network);
+
+}  // namespace MKLDNNPlugin
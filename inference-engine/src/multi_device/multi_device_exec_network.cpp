@@ -10,6 +10,7 @@
 #include <utility>
 #include <map>
 #include <unordered_map>
+#include <algorithm>
 
 
 #include "ie_metric_helpers.hpp"
@@ -59,6 +60,9 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto itPolicy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    _earliestCompletionPolicy = itPolicy != _config.end() &&
+                                itPolicy->second.as<std::string>() == MULTI_CONFIG_VALUE(EARLIEST_COMPLETION);
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -80,6 +84,8 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
         auto& idleWorkerRequests = _idleWorkerRequests[device];
         workerRequests.resize(numRequests);
         _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
+        _deviceStatistics[device] = std::unique_ptr<DeviceStatistics>(new DeviceStatistics);
+        auto* deviceStatisticsPtr = _deviceStatistics[device].get();
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         idleWorkerRequests.set_capacity(numRequests);
         for (auto&& workerRequest : workerRequests) {
@@ -87,9 +93,19 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
             auto* workerRequestPtr = &workerRequest;
             IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
             workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, deviceStatisticsPtr] (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_status = status;
+                    {
+                        auto latency = std::chrono::duration<double, std::milli>(
+                            std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count();
+                        std::lock_guard<std::mutex> lock(deviceStatisticsPtr->_mutex);
+                        // exponential moving average, so the estimate follows the device load changes
+                        deviceStatisticsPtr->_averageLatency = deviceStatisticsPtr->_completed == 0 ? latency :
+                            0.9 * deviceStatisticsPtr->_averageLatency + 0.1 * latency;
+                        deviceStatisticsPtr->_completed++;
+                        deviceStatisticsPtr->_running--;
+                    }
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
@@ -99,21 +115,58 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                         // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
                         // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
                         Task t;
-                        if (_inferPipelineTasks.try_pop(t))
+                        if (_inferPipelineTasks.try_pop(t)) {
                             ScheduleToWorkerInferRequest(std::move(t));
-                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
+                        } else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t)) {
+                            deviceStatisticsPtr->_queued--;
                             ScheduleToWorkerInferRequest(std::move(t), device);
+                        }
                     }
                 });
         }
     }
 }
 
+std::vector<DeviceInformation> MultiDeviceExecutableNetwork::OrderByEarliestCompletion(
+    std::vector<DeviceInformation> devices) {
+    std::vector<std::pair<double, DeviceInformation>> completions;
+    for (auto&& device : devices) {
+        auto& statistics = *_deviceStatistics.at(device.deviceName);
+        auto numRequests = static_cast<double>(std::max<std::size_t>(_workerRequests.at(device.deviceName).size(), 1));
+        auto pending = static_cast<double>(statistics._running + statistics._queued);
+        double completion = 0.0;
+        {
+            std::lock_guard<std::mutex> lock(statistics._mutex);
+            // the latency is unknown until the first inference completes, so such a device is tried first
+            if (statistics._completed != 0) {
+                // a request starts at once if the device has an idle request, otherwise it waits for previous ones
+                completion = statistics._averageLatency * std::max(1.0, (pending + 1) / numRequests);
+            }
+        }
+        completions.emplace_back(completion, std::move(device));
+    }
+    // devices with equal estimates keep their priority order
+    std::stable_sort(completions.begin(), completions.end(),
+        [] (const std::pair<double, DeviceInformation>& lhs, const std::pair<double, DeviceInformation>& rhs) {
+            return lhs.first < rhs.first;
+        });
+    devices.clear();
+    for (auto&& completion : completions) {
+        devices.push_back(std::move(completion.second));
+    }
+    return devices;
+}
+
 void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device) {
     auto devices = [&] {
         std::lock_guard<std::mutex> lock(_mutex);
         return _devicePriorities;
     }();
+    if (_earliestCompletionPolicy && preferred_device.empty()) {
+        // the estimate only chooses among devices with an idle request, a task which finds no idle request waits in
+        // the device-agnostic queue for the first request which becomes idle on any device
+        devices = OrderByEarliestCompletion(std::move(devices));
+    }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
@@ -122,6 +175,15 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         if (idleWorkerRequests.try_pop(workerRequestPtr)) {
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
             _thisWorkerInferRequest = workerRequestPtr;
+            {
+                auto& statistics = *_deviceStatistics.at(device.deviceName);
+                workerRequestPtr->_startTime = std::chrono::steady_clock::now();
+                std::lock_guard<std::mutex> lock(statistics._mutex);
+                if (statistics._completed == 0 && statistics._running == 0) {
+                    statistics._firstStart = workerRequestPtr->_startTime;
+                }
+                statistics._running++;
+            }
             {
                 auto capturedTask = std::move(inferPipelineTask);
                 capturedTask();
@@ -131,10 +193,12 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         }
     }
     // no vacant requests this time, storing the task to the respective queue
-    if (!preferred_device.empty())
+    if (!preferred_device.empty()) {
+        _deviceStatistics.at(preferred_device)->_queued++;
         _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(inferPipelineTask));
-    else
+    } else {
         _inferPipelineTasks.push(std::move(inferPipelineTask));
+    }
 }
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
@@ -268,15 +332,34 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
         IE_ASSERT(it != _networksPerDevice.end());
         IE_SET_METRIC_RETURN(NETWORK_NAME, it->second.GetMetric(
             METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == MULTI_METRIC_KEY(DEVICE_THROUGHPUT) || name == MULTI_METRIC_KEY(DEVICE_LATENCY)) {
+        std::map<std::string, float> throughput, latency;
+        auto now = std::chrono::steady_clock::now();
+        for (auto&& statisticsValue : _deviceStatistics) {
+            auto& statistics = *statisticsValue.second;
+            std::lock_guard<std::mutex> lock(statistics._mutex);
+            auto duration = std::chrono::duration<double>(now - statistics._firstStart).count();
+            throughput[statisticsValue.first] = statistics._completed == 0 || duration <= 0 ? 0.f :
+                static_cast<float>(statistics._completed / duration);
+            latency[statisticsValue.first] = static_cast<float>(statistics._averageLatency);
+        }
+        if (name == MULTI_METRIC_KEY(DEVICE_THROUGHPUT)) {
+            IE_SET_METRIC_RETURN(MULTI_DEVICE_THROUGHPUT, throughput);
+        } else {
+            IE_SET_METRIC_RETURN(MULTI_DEVICE_LATENCY, latency);
+        }
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            MULTI_METRIC_KEY(DEVICE_THROUGHPUT),
+            MULTI_METRIC_KEY(DEVICE_LATENCY)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
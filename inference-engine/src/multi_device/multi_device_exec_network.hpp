@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -102,6 +103,15 @@ public:
         InferenceEngine::InferRequest   _inferRequest;
         InferenceEngine::Task           _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        std::chrono::steady_clock::time_point _startTime;
+    };
+    struct DeviceStatistics {
+        std::mutex                              _mutex;
+        double                                  _averageLatency = 0.0;  // running average in milliseconds
+        std::size_t                             _completed = 0;
+        std::chrono::steady_clock::time_point   _firstStart;
+        std::atomic_size_t                      _running = {0};         // requests started on the device
+        std::atomic_size_t                      _queued = {0};          // tasks waiting in the device specific queue
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
 
@@ -121,6 +131,7 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "");
+    std::vector<DeviceInformation> OrderByEarliestCompletion(std::vector<DeviceInformation> devices);
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
@@ -135,6 +146,8 @@ public:
     DeviceMap<std::unique_ptr<ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    DeviceMap<std::unique_ptr<DeviceStatistics>>                _deviceStatistics;
+    bool                                                        _earliestCompletionPolicy = false;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
@@ -126,6 +126,14 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void calcRowCubicV_8U(uint8_t dst[], const float src[], const float beta[], int length) {
+    calcRowCubicV_8U_impl(dst, src, beta, length);
+}
+
+void calcRowCubicV_32F(float dst[], const float src[], const float beta[], int length) {
+    calcRowCubicV_32F_impl(dst, src, beta, length);
+}
+
 }  // namespace neon
 }  // namespace kernels
 }  // namespace gapi
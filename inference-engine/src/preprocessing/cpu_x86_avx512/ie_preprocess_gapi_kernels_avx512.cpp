@@ -656,6 +656,14 @@ void calcRowLinear_32F(float *dst[],
     calcRowLinear_32FC1(dst, src0, src1, alpha, mapsx, beta, inSz, outSz, lpi);
 }
 
+void calcRowCubicV_8U(uint8_t dst[], const float src[], const float beta[], int length) {
+    calcRowCubicV_8U_impl(dst, src, beta, length);
+}
+
+void calcRowCubicV_32F(float dst[], const float src[], const float beta[], int length) {
+    calcRowCubicV_32F_impl(dst, src, beta, length);
+}
+
 }  // namespace avx512
 }  // namespace kernels
 }  // namespace gapi
@@ -200,6 +200,17 @@ void copyRow_32F(const float in[],
                  float out[],
                  int length);
 
+// Resize (bi-cubic, vertical pass over 4 input rows packed as 32FC4)
+void calcRowCubicV_8U(uint8_t     dst[],
+                      const float src[],
+                      const float beta[],
+                      int         length);
+
+void calcRowCubicV_32F(float       dst[],
+                       const float src[],
+                       const float beta[],
+                       int         length);
+
 }  // namespace avx512
 }  // namespace kernels
 }  // namespace gapi
@@ -1353,6 +1353,14 @@ void copyRow_32F(const float in[],
     copyRow_32F_impl(in, out, length);
 }
 
+void calcRowCubicV_8U(uint8_t dst[], const float src[], const float beta[], int length) {
+    calcRowCubicV_8U_impl(dst, src, beta, length);
+}
+
+void calcRowCubicV_32F(float dst[], const float src[], const float beta[], int length) {
+    calcRowCubicV_32F_impl(dst, src, beta, length);
+}
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -10,6 +10,10 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <map>
+#include <numeric>
+#include <cmath>
+#include <limits>
 
 // Careful reader, don't worry -- it is not the whole OpenCV,
 // it is just a single stand-alone component of it
@@ -564,7 +568,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 
     // specific pre-processing case:
     // 1. Requires interleaved image of type CV_8UC3/CV_8UC4 (except for NV12/I420 input)
-    // 2. Supports bilinear resize only
+    // 2. Supports bilinear and nearest neighbor resize only
     // 3. Supports NV12/I420 -> RGB/BGR color transformations
     const bool nv12_input = (input_color_format == ColorFormat::NV12);
     const bool i420_input = (input_color_format == ColorFormat::I420);
@@ -576,7 +580,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
     const bool specific_case_of_preproc = ((in_layout == NHWC || specific_yuv420_input_handling)
                                         && (in_desc.d.C == 3 || specific_yuv420_input_handling || drop_channel)
                                         && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec))
-                                        && (algorithm == RESIZE_BILINEAR)
+                                        && (algorithm == RESIZE_BILINEAR || algorithm == RESIZE_NEAREST)
                                         && (input_color_format == ColorFormat::RAW
                                             || input_color_format == output_color_format
                                             || drop_channel
@@ -584,6 +588,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
     if (specific_case_of_preproc) {
         const auto input_sz = cv::gapi::own::Size(in_desc.d.W, in_desc.d.H);
         const auto scale_sz = cv::gapi::own::Size(out_desc.d.W, out_desc.d.H);
+        const int interp = (algorithm == RESIZE_NEAREST) ? cv::INTER_NEAREST : cv::INTER_LINEAR;
 
         // convert color format to RGB in case of NV12 input
         std::vector<cv::GMat> color_converted_input;
@@ -597,9 +602,9 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 
         auto planes = drop_channel ?
                 to_vec(gapi::ScalePlanes4:: on(
-                        color_converted_input[0], in_desc.prec, input_sz, scale_sz, cv::INTER_LINEAR))
+                        color_converted_input[0], in_desc.prec, input_sz, scale_sz, interp))
               : to_vec(gapi::ScalePlanes  ::on(
-                        color_converted_input[0], in_desc.prec, input_sz, scale_sz, cv::INTER_LINEAR));
+                        color_converted_input[0], in_desc.prec, input_sz, scale_sz, interp));
 
         if (drop_channel) {
             planes.pop_back();
@@ -643,6 +648,8 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             switch (ar) {
             case RESIZE_AREA:     return cv::INTER_AREA;
             case RESIZE_BILINEAR: return cv::INTER_LINEAR;
+            case RESIZE_NEAREST:  return cv::INTER_NEAREST;
+            case RESIZE_BICUBIC:  return cv::INTER_CUBIC;
             default: THROW_IE_EXCEPTION << "Unsupported resize operation";
             }
         } (algorithm);
@@ -683,6 +690,64 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 
     return cv::GComputation(inputs, outputs);
 }
+// Returns the `slice_n`-th of `total_slices` horizontal slices of an output image. Remainder rows
+// are distributed one by one among the first slices, so a slice may be empty if there are more
+// slices than rows.
+cv::gapi::own::Rect slice_rows(int rows, int cols, int slice_n, int total_slices) {
+    auto lines_per_slice = rows / total_slices;
+    const auto remainder = rows % total_slices;
+
+    int roi_y = 0;
+    if (slice_n < remainder) {
+        lines_per_slice++;  // 1 additional row
+        roi_y = slice_n * lines_per_slice;  // all previous rois have lines+1 rows
+    } else {
+        // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
+        roi_y = remainder * (lines_per_slice + 1) + (slice_n - remainder) * lines_per_slice;
+    }
+    return cv::gapi::own::Rect{0, roi_y, cols, lines_per_slice};
+}
+
+// Returns the part of an output image an input image is resized into in letterbox mode:
+// the input is scaled by the same factor along both axes to fit the output and centered
+cv::gapi::own::Rect letterbox_rect(int in_w, int in_h, int out_w, int out_h) {
+    const double scale = std::min(static_cast<double>(out_w) / in_w, static_cast<double>(out_h) / in_h);
+    const int w = std::max(1, std::min(out_w, static_cast<int>(std::lround(in_w * scale))));
+    const int h = std::max(1, std::min(out_h, static_cast<int>(std::lround(in_h * scale))));
+    return cv::gapi::own::Rect{(out_w - w) / 2, (out_h - h) / 2, w, h};
+}
+
+template<typename T>
+T saturate_round(float value) {
+    const float lo = static_cast<float>(std::numeric_limits<T>::min());
+    const float hi = static_cast<float>(std::numeric_limits<T>::max());
+    return static_cast<T>(std::min(std::max(std::round(value), lo), hi));
+}
+
+template<typename T>
+void fill_outside(cv::gapi::own::Mat& mat, const cv::gapi::own::Rect& roi, T value) {
+    const int chan = mat.channels();
+    for (int y = 0; y < mat.rows; y++) {
+        T* row = reinterpret_cast<T*>(mat.ptr(y));
+        if (y < roi.y || y >= roi.y + roi.height) {
+            std::fill(row, row + mat.cols * chan, value);
+        } else {
+            std::fill(row, row + roi.x * chan, value);
+            std::fill(row + (roi.x + roi.width) * chan, row + mat.cols * chan, value);
+        }
+    }
+}
+
+// Fills the part of the output plane not covered by the resized image in letterbox mode
+void fill_letterbox_border(cv::gapi::own::Mat& mat, const cv::gapi::own::Rect& roi, Precision prec,
+                           float value) {
+    switch (prec) {
+    case Precision::U8:   fill_outside(mat, roi, saturate_round<uint8_t>(value));  break;
+    case Precision::U16:  fill_outside(mat, roi, saturate_round<uint16_t>(value)); break;
+    case Precision::FP32: fill_outside(mat, roi, value); break;
+    default: THROW_IE_EXCEPTION << "Letterbox resize is not supported for " << prec << " network's input";
+    }
+}
 }  // anonymous namespace
 
 PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
@@ -761,10 +826,11 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
-    // src is either a memory blob, an NV12, or an I420 blob
+    // src is either a memory blob, an NV12, an I420 blob or a batch of memory blobs
     const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
-    if (!src->is<MemoryBlob>() && !yuv420_blob) {
-        THROW_IE_EXCEPTION  << "Unsupported input blob type: expected MemoryBlob, NV12Blob or I420Blob";
+    if (!src->is<MemoryBlob>() && !yuv420_blob && !src->is<BatchedBlob>() && !src->is<VariableSizeBatchedBlob>()) {
+        THROW_IE_EXCEPTION  << "Unsupported input blob type: expected MemoryBlob, NV12Blob, I420Blob, BatchedBlob "
+                               "or VariableSizeBatchedBlob";
     }
 
     // dst is always a memory blob
@@ -799,7 +865,17 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
         THROW_IE_EXCEPTION << "Input pre-processing is called with invalid batch size " << batch;
     }
 
-    if (blob->is<CompoundBlob>()) {
+    if (blob->is<BatchedBlob>() || blob->is<VariableSizeBatchedBlob>()) {
+        // every underlying blob is a separate image
+        const auto images = static_cast<int>(blob->size());
+        if (batch > images) {
+            THROW_IE_EXCEPTION  << "Provided batch size " << batch << " exceeds the number of images "
+                                << images << " in the batched blob";
+        }
+        if (batch < 0) {
+            batch = images;
+        }
+    } else if (blob->is<CompoundBlob>()) {
         // batch size must always be 1 in compound blob case
         if (batch > 1) {
             THROW_IE_EXCEPTION  << "Provided input blob batch size " << batch
@@ -848,24 +924,9 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             const auto& input_plane_mats = batched_input_plane_mats[0];
             const auto& output_plane_mats = batched_output_plane_mats[0];
 
-            auto lines_per_thread = output_plane_mats[0].rows / total_slices;
-            const auto remainder = output_plane_mats[0].rows % total_slices;
-
-            // remainder shows how many threads must calculate 1 additional row. now these additions
-            // must also be addressed in rect's Y coordinate:
-            int roi_y = 0;
-            if (slice_n < remainder) {
-                lines_per_thread++;  // 1 additional row
-                roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
-            } else {
-                // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
-                roi_y =
-                    remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
-            }
-
-            if (lines_per_thread <= 0) return;  // no job for current thread
+            auto roi = slice_rows(output_plane_mats[0].rows, output_plane_mats[0].cols, slice_n, total_slices);
+            if (roi.height <= 0) return;  // no job for current thread
 
-            auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
             std::vector<Rect> rois(output_plane_mats.size(), roi);
 
             // TODO: make a ROI a runtime argument to avoid
@@ -898,7 +959,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 template<typename BlobTypePtr>
 void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
     ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    int batch_size, ResizeMode resize_mode, float pad_value) {
 
     validateBlob(inBlob);
 
@@ -932,13 +993,27 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                             << batch_size << " > " << out_desc.d.N << " (expected by network)";
     }
 
+    // in letterbox mode the graph resizes the input into the centered part of the output
+    // keeping the aspect ratio, the rest of the output is filled with the pad value
+    const bool letterbox = (resize_mode == RESIZE_LETTERBOX) && (algorithm != NO_RESIZE);
+    auto resized_desc = out_desc;
+    auto resized_dims = out_desc_ie.getDims();
+    auto resized_rect = cv::gapi::own::Rect{0, 0, out_desc.d.W, out_desc.d.H};
+    if (letterbox) {
+        resized_rect = letterbox_rect(in_desc.d.W, in_desc.d.H, out_desc.d.W, out_desc.d.H);
+        resized_desc.d.W = resized_rect.width;
+        resized_desc.d.H = resized_rect.height;
+        resized_dims[2] = resized_rect.height;
+        resized_dims[3] = resized_rect.width;
+    }
+
     CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
                                             in_layout,
                                             in_desc_ie.getDims(),
                                             in_fmt },
                                   BlobDesc{ out_desc_ie.getPrecision(),
                                             out_layout,
-                                            out_desc_ie.getDims(),
+                                            resized_dims,
                                             out_fmt },
                                   algorithm };
 
@@ -960,7 +1035,7 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
             auto custom_desc = getGDesc(in_desc, inBlob);
             _lastComputation = cv::util::make_optional(
                 buildGraph(custom_desc,
-                           out_desc,
+                           resized_desc,
                            in_layout,
                            out_layout,
                            algorithm,
@@ -972,12 +1047,185 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
+    if (letterbox) {
+        for (auto& output_plane_mats : batched_output_plane_mats) {
+            for (auto& plane : output_plane_mats) {
+                fill_letterbox_border(plane, resized_rect, out_desc_ie.getPrecision(), pad_value);
+                plane = plane(resized_rect);
+            }
+        }
+    }
+
     executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
         omp_serial, update);
 }
 
+void PreprocEngine::preprocessBatchedBlob(const CompoundBlob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+    int batch_size) {
+    const auto& out_desc_ie = outBlob->getTensorDesc();
+    validateTensorDesc(out_desc_ie);
+    const auto out_desc = G::decompose(out_desc_ie);
+
+    if (static_cast<int>(inBlob->size()) != out_desc.d.N) {
+        THROW_IE_EXCEPTION  << "Input blob batch size is invalid: (input blob) "
+                            << inBlob->size() << " != " << out_desc.d.N << " (expected by network)";
+    }
+
+    // images of a VariableSizeBatchedBlob may have different sizes, but precision, layout and channels
+    // must be equal, which is checked per image as the graphs are built for the first image description
+    std::vector<MemoryBlob::Ptr> images(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+        images[i] = as<MemoryBlob>(inBlob->getBlob(i));
+        if (!images[i]) {
+            THROW_IE_EXCEPTION  << "Unsupported blob in a batch of images: expected MemoryBlob";
+        }
+        const auto& desc = images[i]->getTensorDesc();
+        validateTensorDesc(desc);
+        if (desc.getDims()[0] != 1) {
+            THROW_IE_EXCEPTION  << "Images in a batch should have batch size 1";
+        }
+        const auto& firstDesc = images[0]->getTensorDesc();
+        if (desc.getPrecision() != firstDesc.getPrecision() || desc.getLayout() != firstDesc.getLayout() ||
+            desc.getDims()[1] != firstDesc.getDims()[1]) {
+            THROW_IE_EXCEPTION  << "Image " << i << " in a batch has different precision, layout or number of "
+                                << "channels than the first image";
+        }
+    }
+
+    const auto& in_desc_ie = images[0]->getTensorDesc();
+    const auto in_layout = in_desc_ie.getLayout();
+    const auto out_layout = out_desc_ie.getLayout();
+
+    // sizes are handled per task below, so only the rest of the call description is tracked
+    CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
+                                            in_layout,
+                                            SizeVector{1, in_desc_ie.getDims()[1]},
+                                            in_fmt },
+                                  BlobDesc{ out_desc_ie.getPrecision(),
+                                            out_layout,
+                                            out_desc_ie.getDims(),
+                                            out_fmt },
+                                  algorithm };
+    const bool rebuild = !_lastBatchedCall || *_lastBatchedCall != thisCall;
+    _lastBatchedCall = cv::util::make_optional(std::move(thisCall));
+
+    const int thread_num =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+#endif
+        parallel_get_max_threads();
+
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+    // The cost of an image is estimated by the number of pixels read and written. If there are fewer
+    // images than threads, rows of every image are split into a number of slices proportional to its
+    // cost, otherwise images are processed as a whole. Tasks are then assigned to threads starting
+    // from the most expensive one to the least loaded thread.
+    const float out_pixels = static_cast<float>(out_desc.d.H) * out_desc.d.W;
+    std::vector<float> image_costs(batch_size);
+    float total_cost = 0.f;
+    for (int i = 0; i < batch_size; ++i) {
+        const auto& dims = images[i]->getTensorDesc().getDims();
+        image_costs[i] = out_pixels + static_cast<float>(dims[2]) * dims[3];
+        total_cost += image_costs[i];
+    }
+
+    std::vector<BatchedTask> tasks;
+    for (int i = 0; i < batch_size; ++i) {
+        const auto& dims = images[i]->getTensorDesc().getDims();
+        int slices = 1;
+        if (batch_size < thread_num) {
+            slices = static_cast<int>(std::lround(thread_num * image_costs[i] / total_cost));
+            slices = std::min(std::max(slices, 1), out_desc.d.H);
+        }
+        const bool upscale = static_cast<int>(dims[2]) < out_desc.d.H || static_cast<int>(dims[3]) < out_desc.d.W;
+        for (int slice_n = 0; slice_n < slices; ++slice_n) {
+            const auto roi = slice_rows(out_desc.d.H, out_desc.d.W, slice_n, slices);
+            tasks.push_back(BatchedTask{static_cast<size_t>(i), roi.y, roi.height, dims, upscale,
+                                        image_costs[i] / slices, 0, Update::REBUILD, cv::GCompiled{}});
+        }
+    }
+
+    std::vector<size_t> order(tasks.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return tasks[a].cost > tasks[b].cost; });
+    std::vector<float> thread_loads(thread_num, 0.f);
+    for (auto t : order) {
+        const auto thread = std::min_element(thread_loads.begin(), thread_loads.end()) - thread_loads.begin();
+        tasks[t].thread = static_cast<int>(thread);
+        thread_loads[thread] += tasks[t].cost;
+    }
+
+    // compiled graphs of the previous call are reshaped if only the input size or ROI has changed,
+    // AREA resize uses different kernels for upscale and downscale and has to be recompiled
+    std::map<bool, cv::GComputation> computations;
+    for (size_t t = 0; t < tasks.size(); ++t) {
+        auto& task = tasks[t];
+        if (!rebuild && t < _batchedTasks.size() &&
+            (algorithm != RESIZE_AREA || _batchedTasks[t].upscale == task.upscale)) {
+            const auto& last = _batchedTasks[t];
+            task.compiled = std::move(_batchedTasks[t].compiled);
+            task.update = (last.roi_y == task.roi_y && last.roi_height == task.roi_height &&
+                           last.in_dims == task.in_dims) ? Update::NOTHING : Update::RESHAPE;
+        } else if (computations.find(task.upscale) == computations.end()) {
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+            const auto& image = images[task.image];
+            computations.emplace(task.upscale, buildGraph(getGDesc(G::decompose(image), image),
+                                                          out_desc, in_layout, out_layout, algorithm,
+                                                          in_fmt, out_fmt));
+        }
+    }
+
+    std::vector<std::vector<cv::gapi::own::Mat>> batched_input_plane_mats;
+    batched_input_plane_mats.reserve(batch_size);
+    for (const auto& image : images) {
+        batched_input_plane_mats.emplace_back(std::move(bind_to_blob(image, 1)[0]));
+    }
+    auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
+
+    parallel_nt_static(thread_num, [&, this](int thread_n, const int total_threads) {
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
+
+        for (auto& task : tasks) {
+            // the runtime may provide fewer threads than requested
+            if (task.thread % total_threads != thread_n || task.roi_height <= 0) continue;
+
+            const auto& input_plane_mats = batched_input_plane_mats[task.image];
+            auto& output_plane_mats = batched_output_plane_mats[task.image];
+
+            if (Update::NOTHING != task.update) {
+                OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
+
+                using cv::gapi::own::Rect;
+                auto roi = Rect{0, task.roi_y, output_plane_mats[0].cols, task.roi_height};
+                std::vector<Rect> rois(output_plane_mats.size(), roi);
+                auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
+                if (Update::REBUILD == task.update) {
+                    task.compiled = computations.at(task.upscale).compile(descrs_of(input_plane_mats), std::move(args));
+                } else {
+                    IE_ASSERT(task.compiled);
+                    task.compiled.reshape(descrs_of(input_plane_mats), std::move(args));
+                }
+            }
+
+            cv::GRunArgs call_ins;
+            cv::GRunArgsP call_outs;
+            for (const auto & m : input_plane_mats) { call_ins.emplace_back(m);}
+            for (auto & m : output_plane_mats) { call_outs.emplace_back(&m);}
+
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_graph);
+            task.compiled(std::move(call_ins), std::move(call_outs));
+        }
+    });
+
+    _batchedTasks = std::move(tasks);
+}
+
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        ResizeMode resize_mode, float pad_value) {
     const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
 
     // output is always a memory blob
@@ -997,7 +1245,7 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected NV12Blob";
         }
         return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, resize_mode, pad_value);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -1006,17 +1254,25 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected I420Blob";
         }
         return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, resize_mode, pad_value);
     }
 
     default:
+        if (inBlob->is<BatchedBlob>() || inBlob->is<VariableSizeBatchedBlob>()) {
+            if (resize_mode == RESIZE_LETTERBOX && algorithm != NO_RESIZE) {
+                THROW_IE_EXCEPTION << "Letterbox resize is not supported for a batch of images input";
+            }
+            return preprocessBatchedBlob(as<CompoundBlob>(inBlob), outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
+                batch_size);
+        }
+
         auto inMemoryBlob = as<MemoryBlob>(inBlob);
         if (!inMemoryBlob) {
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected MemoryBlob";
         }
         return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, resize_mode, pad_value);
     }
 }
 }  // namespace InferenceEngine
@@ -36,6 +36,22 @@ class PreprocEngine {
     enum class Update { REBUILD, RESHAPE, NOTHING };
     Update needUpdate(const CallDesc &newCall) const;
 
+    // A horizontal slice of an output image of a batch of images processed by one thread
+    struct BatchedTask {
+        size_t image;
+        int roi_y;
+        int roi_height;
+        SizeVector in_dims;
+        bool upscale;
+        float cost;
+        int thread;
+        Update update;
+        cv::GCompiled compiled;
+    };
+
+    Opt<CallDesc> _lastBatchedCall;
+    std::vector<BatchedTask> _batchedTasks;
+
     void executeGraph(Opt<cv::GComputation>& lastComputation,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
@@ -45,6 +61,10 @@ class PreprocEngine {
 
     template<typename BlobTypePtr>
     void preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+        int batch_size, ResizeMode resize_mode, float pad_value);
+
+    void preprocessBatchedBlob(const CompoundBlob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
         int batch_size);
 
@@ -53,7 +73,8 @@ public:
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1,
+        ResizeMode resize_mode = RESIZE_STRETCH, float pad_value = 0.f);
 };
 
 }  // namespace InferenceEngine
@@ -814,10 +814,44 @@ G_TYPED_KERNEL(ScalePlaneArea32f, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie
     }
 };
 
+G_TYPED_KERNEL(ScalePlaneNearest, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie.scale_plane_nearest") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &sz, int) {
+        GAPI_DbgAssert((in.depth == CV_8U || in.depth == CV_32F) && in.chan == 1);
+        return in.withSize(sz);
+    }
+};
+
+// Bi-cubic resize is split into three Fluid-friendly stages: horizontal resize (the
+// height is kept), packing of the 4 input rows every output row depends on into a
+// single 4-channel row, and vertical resize which reads a single packed row.
+G_TYPED_KERNEL(ScalePlaneCubicH, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie.scale_plane_cubic_h") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &sz, int) {
+        GAPI_DbgAssert((in.depth == CV_8U || in.depth == CV_32F) && in.chan == 1);
+        return in.withType(CV_32F, 1).withSize(Size(sz.width, in.size.height));
+    }
+};
+
+G_TYPED_KERNEL(PackCubicRows, <cv::GMat(cv::GMat)>, "com.intel.ie.pack_cubic_rows") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in) {
+        GAPI_DbgAssert(in.depth == CV_32F && in.chan == 1);
+        return in.withType(CV_32F, 4);
+    }
+};
+
+G_TYPED_KERNEL(ScalePlaneCubicV, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie.scale_plane_cubic_v") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &sz, int depth) {
+        GAPI_DbgAssert(in.depth == CV_32F && in.chan == 4);
+        GAPI_DbgAssert(in.size.width == sz.width);
+        GAPI_DbgAssert(depth == CV_8U || depth == CV_32F);
+        return in.withType(depth, 1).withSize(sz);
+    }
+};
+
 GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
     static cv::GMat expand(cv::GMat in, int type, const Size& szIn, const Size& szOut, int interp) {
         GAPI_DbgAssert(CV_8UC1 == type || CV_32FC1 == type);
-        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp ||
+                       cv::INTER_NEAREST == interp || cv::INTER_CUBIC == interp);
 
         if (cv::INTER_AREA == interp) {
             bool upscale = szIn.width < szOut.width || szIn.height < szOut.height;
@@ -844,6 +878,15 @@ GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
             }
         }
 
+        if (cv::INTER_NEAREST == interp) {
+            return ScalePlaneNearest::on(in, szOut, interp);
+        }
+
+        if (cv::INTER_CUBIC == interp) {
+            auto horizontal = ScalePlaneCubicH::on(in, szOut, interp);
+            return ScalePlaneCubicV::on(PackCubicRows::on(horizontal), szOut, CV_MAT_DEPTH(type));
+        }
+
         GAPI_Assert(!"unsupported parameters");
         return {};
     }
@@ -1970,6 +2013,73 @@ static void calcAreaRow_CVKL_U8(const cv::gapi::fluid::View   & in,
 #endif  // CVKL
 //----------------------------------------------------------------------
 
+namespace nearest {
+// Pixel centers are mapped, so the nearest input pixel always belongs to the
+// input window Fluid provides for the bi-linear resize
+static inline int map(double ratio, int inSz, int outCoord) {
+    return (std::min)(static_cast<int>(cvFloor((outCoord + 0.5) * ratio)), inSz - 1);
+}
+}  // namespace nearest
+
+static void initScratchNearest(const cv::GMatDesc& in, const Size& outSz,
+                               cv::gapi::fluid::Buffer& scratch) {
+    Size scratch_size{static_cast<int>((outSz.width + outSz.height) * sizeof(int)), 1};
+
+    cv::GMatDesc desc;
+    desc.chan = 1;
+    desc.depth = CV_8UC1;
+    desc.size = scratch_size;
+
+    cv::gapi::fluid::Buffer buffer(desc);
+    scratch = std::move(buffer);
+
+    auto *mapsx = scratch.OutLine<int>();
+    auto *mapsy = mapsx + outSz.width;
+
+    double hRatio = ratio(in.size.width, outSz.width);
+    double vRatio = ratio(in.size.height, outSz.height);
+
+    for (int x = 0; x < outSz.width; x++) {
+        mapsx[x] = nearest::map(hRatio, in.size.width, x);
+    }
+
+    for (int y = 0; y < outSz.height; y++) {
+        mapsy[y] = nearest::map(vRatio, in.size.height, y);
+    }
+}
+
+// Nearest neighbor resize is a pure gather, so there are no SIMD versions of it
+template<typename T, int numChan>
+static void calcRowNearestC(const cv::gapi::fluid::View& in,
+                            std::array<std::reference_wrapper<cv::gapi::fluid::Buffer>, numChan>& out,
+                            cv::gapi::fluid::Buffer& scratch) {
+    const auto outSz = out[0].get().meta().size;
+    const int  outY  = out[0].get().y();
+    const int  lpi   = out[0].get().lpi();
+    GAPI_DbgAssert(outY + lpi <= outSz.height);
+
+    const auto *mapsx = scratch.OutLine<const int>();
+    const auto *mapsy = mapsx + outSz.width;
+
+    for (int l = 0; l < lpi; l++) {
+        const T* src = in.InLine<const T>(mapsy[outY + l] - in.y());
+
+        for (int c = 0; c < numChan; c++) {
+            T* dst = out[c].get().template OutLine<T>(l);
+            for (int x = 0; x < outSz.width; x++) {
+                dst[x] = src[mapsx[x] * numChan + c];
+            }
+        }
+    }
+}
+
+template<typename T>
+static void calcRowNearest(const cv::gapi::fluid::View& in, cv::gapi::fluid::Buffer& out,
+                           cv::gapi::fluid::Buffer& scratch) {
+    std::array<std::reference_wrapper<cv::gapi::fluid::Buffer>, 1> outs = {out};
+    calcRowNearestC<T, 1>(in, outs, scratch);
+}
+
 GAPI_FLUID_KERNEL(FScalePlane8u, ScalePlane8u, true) {
     static const int Window = 1;
     static const int LPI = 4;
@@ -1996,22 +2106,30 @@ GAPI_FLUID_KERNEL(FScalePlanes, ScalePlanes, true) {
     static const auto Kind = cv::GFluidKernel::Kind::Resize;
 
     static void initScratch(const cv::GMatDesc& in, int, Size,
-                            Size outSz, int /*interp*/,
+                            Size outSz, int interp,
                             cv::gapi::fluid::Buffer &scratch) {
-        initScratchLinear<uchar, linear::Mapper, 3>(in, outSz, scratch, LPI);
+        if (cv::INTER_NEAREST == interp) {
+            initScratchNearest(in, outSz, scratch);
+        } else {
+            initScratchLinear<uchar, linear::Mapper, 3>(in, outSz, scratch, LPI);
+        }
     }
 
     static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
     }
 
-    static void run(const cv::gapi::fluid::View& in, int, Size, Size/*sz*/, int /*interp*/,
+    static void run(const cv::gapi::fluid::View& in, int, Size, Size/*sz*/, int interp,
                     cv::gapi::fluid::Buffer& out1,
                     cv::gapi::fluid::Buffer& out2,
                     cv::gapi::fluid::Buffer& out3,
                     cv::gapi::fluid::Buffer& scratch) {
         constexpr int numChan = 3;
         std::array<std::reference_wrapper<cv::gapi::fluid::Buffer>, numChan> out = {out1, out2, out3};
-        calcRowLinearC<uint8_t, linear::Mapper, numChan>(in, out, scratch);
+        if (cv::INTER_NEAREST == interp) {
+            calcRowNearestC<uint8_t, numChan>(in, out, scratch);
+        } else {
+            calcRowLinearC<uint8_t, linear::Mapper, numChan>(in, out, scratch);
+        }
     }
 };
 
@@ -2021,15 +2139,19 @@ GAPI_FLUID_KERNEL(FScalePlanes4, ScalePlanes4, true) {
     static const auto Kind = cv::GFluidKernel::Kind::Resize;
 
     static void initScratch(const cv::GMatDesc& in, int, Size,
-                            Size outSz, int /*interp*/,
+                            Size outSz, int interp,
                             cv::gapi::fluid::Buffer &scratch) {
-        initScratchLinear<uchar, linear::Mapper, 4>(in, outSz, scratch, LPI);
+        if (cv::INTER_NEAREST == interp) {
+            initScratchNearest(in, outSz, scratch);
+        } else {
+            initScratchLinear<uchar, linear::Mapper, 4>(in, outSz, scratch, LPI);
+        }
     }
 
     static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
     }
 
-    static void run(const cv::gapi::fluid::View& in, int, Size, Size/*sz*/, int /*interp*/,
+    static void run(const cv::gapi::fluid::View& in, int, Size, Size/*sz*/, int interp,
                     cv::gapi::fluid::Buffer& out1,
                     cv::gapi::fluid::Buffer& out2,
                     cv::gapi::fluid::Buffer& out3,
@@ -2037,7 +2159,11 @@ GAPI_FLUID_KERNEL(FScalePlanes4, ScalePlanes4, true) {
                     cv::gapi::fluid::Buffer& scratch) {
         constexpr int numChan = 4;
         std::array<std::reference_wrapper<cv::gapi::fluid::Buffer>, numChan> out = {out1, out2, out3, out4};
-        calcRowLinearC<uint8_t, linear::Mapper, numChan>(in, out, scratch);
+        if (cv::INTER_NEAREST == interp) {
+            calcRowNearestC<uint8_t, numChan>(in, out, scratch);
+        } else {
+            calcRowLinearC<uint8_t, linear::Mapper, numChan>(in, out, scratch);
+        }
     }
 };
 
@@ -2172,6 +2298,266 @@ GAPI_FLUID_KERNEL(FScalePlaneArea8u, ScalePlaneArea8u, true) {
     }
 };
 
+//----------------------------------------------------------------------
+
+GAPI_FLUID_KERNEL(FScalePlaneNearest, ScalePlaneNearest, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in,
+                            Size outSz, int /*interp*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        initScratchNearest(in, outSz, scratch);
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size /*sz*/, int /*interp*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        if (in.meta().depth == CV_8U) {
+            calcRowNearest<uint8_t>(in, out, scratch);
+        } else {
+            calcRowNearest<float>(in, out, scratch);
+        }
+    }
+};
+
+//----------------------------------------------------------------------
+
+namespace cubic {
+// Keys cubic convolution kernel with A = -0.75, the one OpenCV's resize uses
+static inline void coeffs(float f, float w[4]) {
+    constexpr float A = -0.75f;
+
+    w[0] = ((A*(f + 1) - 5*A)*(f + 1) + 8*A)*(f + 1) - 4*A;
+    w[1] = ((A + 2)*f - (A + 3))*f*f + 1;
+    w[2] = ((A + 2)*(1 - f) - (A + 3))*(1 - f)*(1 - f) + 1;
+    w[3] = 1.f - w[0] - w[1] - w[2];
+}
+
+// Returns the input pixel preceding the center of an output pixel,
+// the taps are the input pixels [s - 1, s + 2]
+static inline int map(double ratio, int outCoord, float w[4]) {
+    float f = static_cast<float>((outCoord + 0.5) * ratio - 0.5);
+    int s = cvFloor(f);
+    coeffs(f - s, w);
+    return s;
+}
+
+static inline int clamp(int v, int sz) {
+    return (std::max)(0, (std::min)(v, sz - 1));
+}
+}  // namespace cubic
+
+static void initScratchCubicH(const cv::GMatDesc& in, const Size& outSz,
+                              cv::gapi::fluid::Buffer& scratch) {
+    const int outW = outSz.width;
+    Size scratch_size{static_cast<int>(4 * outW * (sizeof(int) + sizeof(float))), 1};
+
+    cv::GMatDesc desc;
+    desc.chan = 1;
+    desc.depth = CV_8UC1;
+    desc.size = scratch_size;
+
+    cv::gapi::fluid::Buffer buffer(desc);
+    scratch = std::move(buffer);
+
+    auto *mapsx = scratch.OutLine<int>();
+    auto *alpha = reinterpret_cast<float*>(mapsx + 4 * outW);
+
+    double hRatio = ratio(in.size.width, outW);
+
+    for (int x = 0; x < outW; x++) {
+        int s = cubic::map(hRatio, x, &alpha[4 * x]);
+        for (int k = 0; k < 4; k++) {
+            mapsx[4 * x + k] = cubic::clamp(s - 1 + k, in.size.width);
+        }
+    }
+}
+
+template<typename T>
+static void calcRowCubicH(const cv::gapi::fluid::View& in, cv::gapi::fluid::Buffer& out,
+                          cv::gapi::fluid::Buffer& scratch) {
+    const int length = out.length();
+
+    const auto *mapsx = scratch.OutLine<const int>();
+    const auto *alpha = reinterpret_cast<const float*>(mapsx + 4 * length);
+
+    const T* src = in.InLine<const T>(0);
+    float*   dst = out.OutLine<float>();
+
+    for (int x = 0; x < length; x++) {
+        const int   *sx = &mapsx[4 * x];
+        const float *a  = &alpha[4 * x];
+        dst[x] = a[0] * src[sx[0]] + a[1] * src[sx[1]] + a[2] * src[sx[2]] + a[3] * src[sx[3]];
+    }
+}
+
+static void initScratchCubicV(const cv::GMatDesc& in, const Size& outSz,
+                              cv::gapi::fluid::Buffer& scratch) {
+    const int outH = outSz.height;
+    Size scratch_size{static_cast<int>(outH * (sizeof(int) + 4 * sizeof(float))), 1};
+
+    cv::GMatDesc desc;
+    desc.chan = 1;
+    desc.depth = CV_8UC1;
+    desc.size = scratch_size;
+
+    cv::gapi::fluid::Buffer buffer(desc);
+    scratch = std::move(buffer);
+
+    auto *mapsy = scratch.OutLine<int>();
+    auto *beta  = reinterpret_cast<float*>(mapsy + outH);
+
+    double vRatio = ratio(in.size.height, outH);
+
+    for (int y = 0; y < outH; y++) {
+        float w[4];
+        int s = cubic::map(vRatio, y, w);
+
+        // packed row `sy` holds input rows [sy - 1, sy + 2] (replicated at the borders),
+        // so the weights of the taps falling outside the image are folded into
+        // the taps of the border rows they are replicated from
+        int sy = cubic::clamp(s, in.size.height);
+        float *b = &beta[4 * y];
+        std::fill(b, b + 4, 0.f);
+        for (int k = 0; k < 4; k++) {
+            b[cubic::clamp(s - 1 + k, in.size.height) - sy + 1] += w[k];
+        }
+        mapsy[y] = sy;
+    }
+}
+
+template<typename T>
+static void calcRowCubicV(const cv::gapi::fluid::View& in, cv::gapi::fluid::Buffer& out,
+                          cv::gapi::fluid::Buffer& scratch) {
+    const auto outSz = out.meta().size;
+    const int  outY  = out.y();
+    const int  length = out.length();
+
+    const auto *mapsy = scratch.OutLine<const int>();
+    const auto *beta  = reinterpret_cast<const float*>(mapsy + outSz.height) + 4 * outY;
+
+    // the mapped row always belongs to the 2-line window Fluid provides for the bi-linear
+    // resize up to rounding errors, which the clamping below guards against
+    const int inY     = in.y();
+    const int lastRow = (std::min)(inY + 1, in.meta().size.height - 1);
+    const int srcY    = (std::min)((std::max)(mapsy[outY], inY), lastRow);
+    GAPI_DbgAssert(std::abs(mapsy[outY] - srcY) <= 1);
+    const float* src = in.InLine<const float>(srcY - inY);
+    T* dst = out.OutLine<T>();
+
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx512::calcRowCubicV_8U(reinterpret_cast<uint8_t*>(dst), src, beta, length);
+        } else {
+            avx512::calcRowCubicV_32F(reinterpret_cast<float*>(dst), src, beta, length);
+        }
+        return;
+    }
+    #endif  // HAVE_AVX512
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx::calcRowCubicV_8U(reinterpret_cast<uint8_t*>(dst), src, beta, length);
+        } else {
+            avx::calcRowCubicV_32F(reinterpret_cast<float*>(dst), src, beta, length);
+        }
+        return;
+    }
+    #endif  // HAVE_AVX2
+
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        if (std::is_same<T, uint8_t>::value) {
+            calcRowCubicV_8U(reinterpret_cast<uint8_t*>(dst), src, beta, length);
+        } else {
+            calcRowCubicV_32F(reinterpret_cast<float*>(dst), src, beta, length);
+        }
+        return;
+    }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+    if (std::is_same<T, uint8_t>::value) {
+        neon::calcRowCubicV_8U(reinterpret_cast<uint8_t*>(dst), src, beta, length);
+    } else {
+        neon::calcRowCubicV_32F(reinterpret_cast<float*>(dst), src, beta, length);
+    }
+    return;
+    #endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        const float *p = &src[4 * x];
+        dst[x] = saturate_cast<T>(p[0] * beta[0] + p[1] * beta[1] + p[2] * beta[2] + p[3] * beta[3]);
+    }
+}
+
+GAPI_FLUID_KERNEL(FScalePlaneCubicH, ScalePlaneCubicH, true) {
+    static const int Window = 1;
+    static const int LPI = 1;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in,
+                            Size outSz, int /*interp*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        initScratchCubicH(in, outSz, scratch);
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size /*sz*/, int /*interp*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        if (in.meta().depth == CV_8U) {
+            calcRowCubicH<uint8_t>(in, out, scratch);
+        } else {
+            calcRowCubicH<float>(in, out, scratch);
+        }
+    }
+};
+
+GAPI_FLUID_KERNEL(FPackCubicRows, PackCubicRows, false) {
+    static const int Window = 5;
+
+    static void run(const cv::gapi::fluid::View& in, cv::gapi::fluid::Buffer& out) {
+        mergeRow<float, 4>({in.InLineB(-1), in.InLineB(0), in.InLineB(1), in.InLineB(2)},
+                           out.OutLineB(), in.length());
+    }
+
+    static cv::gapi::fluid::Border getBorder(const cv::GMatDesc& /*in*/) {
+        return { cv::BORDER_REPLICATE, {} };
+    }
+};
+
+GAPI_FLUID_KERNEL(FScalePlaneCubicV, ScalePlaneCubicV, true) {
+    static const int Window = 1;
+    static const int LPI = 1;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in,
+                            Size outSz, int /*depth*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        initScratchCubicV(in, outSz, scratch);
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size /*sz*/, int depth,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        if (depth == CV_8U) {
+            calcRowCubicV<uint8_t>(in, out, scratch);
+        } else {
+            calcRowCubicV<float>(in, out, scratch);
+        }
+    }
+};
+
 static const int ITUR_BT_601_CY = 1220542;
 static const int ITUR_BT_601_CUB = 2116026;
 static const int ITUR_BT_601_CUG = -409993;
@@ -2417,6 +2803,10 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FUpscalePlaneArea32f
         , FScalePlaneArea8u
         , FScalePlaneArea32f
+        , FScalePlaneNearest
+        , FScalePlaneCubicH
+        , FPackCubicRows
+        , FScalePlaneCubicV
         , FMerge2
         , FMerge3
         , FMerge4
@@ -43,8 +43,8 @@ namespace gapi {
             // This kernel supports only RGB 8U inputs
             GAPI_Assert(in.depth == CV_8U);
             GAPI_Assert(in.chan == 3);
-            // cv::INTER_LINEAR is the only supported interpolation
-            GAPI_Assert(interp == cv::INTER_LINEAR);
+            // cv::INTER_LINEAR and cv::INTER_NEAREST are the only supported interpolations
+            GAPI_Assert(interp == cv::INTER_LINEAR || interp == cv::INTER_NEAREST);
             // ad-hoc withChan
             cv::GMatDesc out_desc = in.withType(in.depth, 1).withSize(szOut);
             return std::make_tuple(out_desc, out_desc, out_desc);
@@ -57,8 +57,8 @@ namespace gapi {
             // This kernel supports only RGB 8U inputs
             GAPI_Assert(in.depth == CV_8U);
             GAPI_Assert(in.chan == 4);
-            // cv::INTER_LINEAR is the only supported interpolation
-            GAPI_Assert(interp == cv::INTER_LINEAR);
+            // cv::INTER_LINEAR and cv::INTER_NEAREST are the only supported interpolations
+            GAPI_Assert(interp == cv::INTER_LINEAR || interp == cv::INTER_NEAREST);
             // ad-hoc withChan
             cv::GMatDesc out_desc = in.withType(in.depth, 1).withSize(szOut);
             return std::make_tuple(out_desc, out_desc, out_desc, out_desc);
@@ -787,6 +787,65 @@ inline void copyRow_32F_impl(const float in[], float out[], int length) {
     }
 }
 
+//------------------------------------------------------------------------------
+
+// Resize (bi-cubic): every pixel of the packed row holds 4 vertically adjacent
+// input pixels, the output pixel is their weighted sum
+#if MANUAL_SIMD
+static inline v_float32 cubicV_impl(const float src[], const v_float32& b0, const v_float32& b1,
+                                    const v_float32& b2, const v_float32& b3) {
+    v_float32 r0, r1, r2, r3;
+    v_load_deinterleave(src, r0, r1, r2, r3);
+    return v_fma(r0, b0, v_fma(r1, b1, v_fma(r2, b2, r3 * b3)));
+}
+#endif
+
+static inline float cubicV_impl(const float src[], const float beta[]) {
+    return src[0]*beta[0] + src[1]*beta[1] + src[2]*beta[2] + src[3]*beta[3];
+}
+
+inline void calcRowCubicV_32F_impl(float dst[], const float src[], const float beta[], int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 b0 = vx_setall_f32(beta[0]);
+    const v_float32 b1 = vx_setall_f32(beta[1]);
+    const v_float32 b2 = vx_setall_f32(beta[2]);
+    const v_float32 b3 = vx_setall_f32(beta[3]);
+
+    for (; x <= length - nlanes; x += nlanes) {
+        vx_store(&dst[x], cubicV_impl(&src[4*x], b0, b1, b2, b3));
+    }
+#endif
+
+    for (; x < length; x++) {
+        dst[x] = cubicV_impl(&src[4*x], beta);
+    }
+}
+
+inline void calcRowCubicV_8U_impl(uint8_t dst[], const float src[], const float beta[], int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 b0 = vx_setall_f32(beta[0]);
+    const v_float32 b1 = vx_setall_f32(beta[1]);
+    const v_float32 b2 = vx_setall_f32(beta[2]);
+    const v_float32 b3 = vx_setall_f32(beta[3]);
+
+    for (; x <= length - 2*nlanes; x += 2*nlanes) {
+        v_int32 r0 = v_round(cubicV_impl(&src[4*x],            b0, b1, b2, b3));
+        v_int32 r1 = v_round(cubicV_impl(&src[4*(x + nlanes)], b0, b1, b2, b3));
+        v_pack_u_store(&dst[x], v_pack(r0, r1));
+    }
+#endif
+
+    for (; x < length; x++) {
+        dst[x] = saturate_cast<uint8_t>(cubicV_impl(&src[4*x], beta));
+    }
+}
+
 // Resize (bi-linear, 32FC1)
 static inline void calcRowLinear_32FC1(float *dst[],
                                        const float *src0[],
@@ -25,6 +25,8 @@ class TRANSFORMATIONS_API Serialize;
  * - order of generated layers in xml file is ngraph specific (given by
  * get_ordered_ops()); MO generates file with different order, but they are
  * logically equivalent
+ * - constant data is written to the bin file directly from Constant buffers; constants
+ * with identical content are stored once and share the same offset
  */
 class ngraph::pass::Serialize : public ngraph::pass::FunctionPass {
 public:
@@ -6,6 +6,7 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <unordered_map>
 #include <unordered_set>
@@ -57,8 +58,68 @@ std::string translate_type_name(const std::string& name) {
     return name;
 }
 
+// Writes constant data into the bin stream directly from Constant buffers. Identical blobs
+// (e.g. shared weights or repeated scales) are written only once: subsequent constants with
+// the same content refer to the offset of the first occurrence.
+class ConstantWriter {
+public:
+    using FilePosition = int64_t;
+
+    explicit ConstantWriter(std::ostream& bin_data)
+        : m_binary_output(bin_data) {
+    }
+
+    FilePosition write(const char* ptr, size_t size) {
+        const FilePosition offset = m_binary_output.tellp();
+
+        // hash is used only to find candidates, actual data is compared byte by byte
+        // as constants are alive during serialization and data pointers are valid
+        const size_t hash = hash_data(ptr, size);
+        const auto range = m_hash_to_blobs.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            const auto& blob = it->second;
+            if (blob.size == size && (blob.ptr == ptr || std::memcmp(blob.ptr, ptr, size) == 0)) {
+                return blob.offset;
+            }
+        }
+
+        m_binary_output.write(ptr, size);
+        m_hash_to_blobs.emplace(hash, Blob{offset, ptr, size});
+        return offset;
+    }
+
+private:
+    struct Blob {
+        FilePosition offset;
+        const char* ptr;
+        size_t size;
+    };
+
+    static size_t hash_data(const char* ptr, size_t size) {
+        size_t seed = size;
+        auto combine = [&seed](uint64_t v) {
+            seed ^= std::hash<uint64_t>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        };
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+            uint64_t v;
+            std::memcpy(&v, ptr + i, sizeof(v));
+            combine(v);
+        }
+        if (i < size) {
+            uint64_t tail = 0;
+            std::memcpy(&tail, ptr + i, size - i);
+            combine(tail);
+        }
+        return seed;
+    }
+
+    std::ostream& m_binary_output;
+    std::unordered_multimap<size_t, Blob> m_hash_to_blobs;
+};
+
 void ngfunction_2_irv10(pugi::xml_node& node,
-                        std::ostream& bin_file,
+                        ConstantWriter& constant_writer,
                         const ngraph::Function& f,
                         const std::map<std::string, ngraph::OpSet>& custom_opsets);
 
@@ -115,7 +176,7 @@ private:
 
 class XmlSerializer : public ngraph::AttributeVisitor {
     pugi::xml_node& m_xml_node;
-    std::ostream& m_bin_data;
+    ConstantWriter& m_constant_writer;
     std::string& m_node_type_name;
     const std::map<std::string, ngraph::OpSet>& m_custom_opsets;
 
@@ -127,11 +188,11 @@ class XmlSerializer : public ngraph::AttributeVisitor {
 
 public:
     XmlSerializer(pugi::xml_node& data,
-                  std::ostream& bin_data,
+                  ConstantWriter& constant_writer,
                   std::string& node_type_name,
                   const std::map<std::string, ngraph::OpSet>& custom_opsets)
         : m_xml_node(data)
-        , m_bin_data(bin_data)
+        , m_constant_writer(constant_writer)
         , m_node_type_name(node_type_name)
         , m_custom_opsets(custom_opsets) {
     }
@@ -250,13 +311,11 @@ public:
         } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
             if (name == "value" &&  translate_type_name(m_node_type_name) == "Const") {
                 const int64_t size = a->get()->size();
-                const int64_t offset = m_bin_data.tellp();
+                auto data = static_cast<const char*>(a->get()->get_ptr());
+                const int64_t offset = m_constant_writer.write(data, size);
 
                 m_xml_node.append_attribute("offset").set_value(offset);
                 m_xml_node.append_attribute("size").set_value(size);
-
-                auto data = static_cast<const char*>(a->get()->get_ptr());
-                m_bin_data.write(data, size);
             }
         }
     }
@@ -316,11 +375,11 @@ public:
             // to layer above (m_xml_node.parent()) as in ngfunction_2_irv10() layer (m_xml_node) with empty attributes
             // is removed.
             pugi::xml_node xml_body = m_xml_node.parent().append_child(name.c_str());
-            ngfunction_2_irv10(xml_body, m_bin_data, *adapter.get(), m_custom_opsets);
+            ngfunction_2_irv10(xml_body, m_constant_writer, *adapter.get(), m_custom_opsets);
             xml_body.remove_attribute("name");
             xml_body.remove_attribute("version");
         } else if (name == "net") {
-            ngfunction_2_irv10(m_xml_node, m_bin_data, *adapter.get(), m_custom_opsets);
+            ngfunction_2_irv10(m_xml_node, m_constant_writer, *adapter.get(), m_custom_opsets);
         } else {
             NGRAPH_CHECK(false, "Unsupported Function name.");
         }
@@ -345,10 +404,10 @@ void visit_exec_graph_node(pugi::xml_node& data, std::string& node_type_name,
 }
 
 const std::unordered_map<ngraph::Node*, int> create_layer_ids(
-    const ngraph::Function& f) {
+    const ngraph::NodeVector& ordered_ops) {
     std::unordered_map<ngraph::Node*, int> layer_ids;
     int id = 0;
-    for (const auto& node : f.get_ordered_ops()) {
+    for (const auto& node : ordered_ops) {
         layer_ids[node.get()] = id++;
     }
     return layer_ids;
@@ -356,9 +415,9 @@ const std::unordered_map<ngraph::Node*, int> create_layer_ids(
 
 const std::vector<Edge> create_edge_mapping(
     const std::unordered_map<ngraph::Node*, int>& layer_ids,
-    const ngraph::Function& f) {
+    const ngraph::NodeVector& ordered_ops) {
     std::vector<Edge> edges;
-    for (const auto& node : f.get_ordered_ops()) {
+    for (const auto& node : ordered_ops) {
         if (ngraph::op::is_parameter(node)) {
             continue;
         }
@@ -575,7 +634,7 @@ bool resolve_dynamic_shapes(const ngraph::Function& f) {
 }
 
 void ngfunction_2_irv10(pugi::xml_node& netXml,
-                        std::ostream& bin_file,
+                        ConstantWriter& constant_writer,
                         const ngraph::Function& f,
                         const std::map<std::string, ngraph::OpSet>& custom_opsets) {
     const bool exec_graph = is_exec_graph(f);
@@ -584,13 +643,15 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
     netXml.append_attribute("version").set_value("10");
     pugi::xml_node layers = netXml.append_child("layers");
 
+    bool has_dynamic_shapes = resolve_dynamic_shapes(f);
+
+    // topological sort is computed once and shared by layers and edges serialization
+    const ngraph::NodeVector ordered_ops = f.get_ordered_ops();
     const std::unordered_map<ngraph::Node*, int> layer_ids =
-        create_layer_ids(f);
+        create_layer_ids(ordered_ops);
     std::unordered_set<std::string> unique_names;
 
-    bool has_dynamic_shapes = resolve_dynamic_shapes(f);
-
-    for (const auto& n : f.get_ordered_ops()) {
+    for (const auto& n : ordered_ops) {
         ngraph::Node* node = n.get();
 
         NGRAPH_CHECK(layer_ids.find(node) != layer_ids.end(), "Internal error");
@@ -613,7 +674,7 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
         if (exec_graph) {
             visit_exec_graph_node(data, node_type_name, node);
         } else {
-            XmlSerializer visitor(data, bin_file, node_type_name, custom_opsets);
+            XmlSerializer visitor(data, constant_writer, node_type_name, custom_opsets);
             NGRAPH_CHECK(node->visit_attributes(visitor),
                          "Visitor API is not supported in ", node);
             rt_info::XmlSerializer{data}.serialize(node->get_rt_info());
@@ -689,12 +750,12 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
         }
     }
     // <edges>
-    const std::vector<Edge> edge_mapping = create_edge_mapping(layer_ids, f);
+    const std::vector<Edge> edge_mapping = create_edge_mapping(layer_ids, ordered_ops);
     pugi::xml_node edges = netXml.append_child("edges");
     for (auto e : edge_mapping) {
         // WA for LSTMCellv0, peephole input shall not be serialized
         if (e.to_port == 6) {
-            auto type_info = f.get_ordered_ops()[e.to_layer]->get_type_info();
+            auto type_info = ordered_ops[e.to_layer]->get_type_info();
             if (!strcmp(type_info.name, "LSTMCell") && type_info.version == 0) {
                 continue;
             }
@@ -724,7 +785,8 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
                 std::string name = "net";
                 pugi::xml_document xml_doc;
                 pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-                XmlSerializer visitor(net_node, bin_file, name, m_custom_opsets);
+                ConstantWriter constant_writer(bin_file);
+                XmlSerializer visitor(net_node, constant_writer, name, m_custom_opsets);
                 visitor.on_attribute(name, f);
 
                 xml_doc.save(xml_file);
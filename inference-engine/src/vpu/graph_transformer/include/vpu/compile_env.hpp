@@ -39,6 +39,19 @@ public:
 
     bool initialized = false;
 
+    // Makes the environment of the compiling thread visible in a worker thread running a part of a pass.
+    class ThreadScope final {
+    public:
+        explicit ThreadScope(const CompileEnv* env);
+        ~ThreadScope();
+
+        ThreadScope(const ThreadScope&) = delete;
+        ThreadScope& operator=(const ThreadScope&) = delete;
+
+    private:
+        CompileEnv* _prev = nullptr;
+    };
+
     CompileEnv(const CompileEnv&) = delete;
     CompileEnv& operator=(const CompileEnv&) = delete;
 
@@ -62,6 +62,7 @@ struct CompilationConfig final {
     bool hwDilation = false;
     bool forceDeprecatedCnnConversion = false;
     bool enableEarlyEltwiseReLUFusion = true;
+    bool enableMemoryAwareStageOrder = false;
 
     std::map<std::string, std::vector<int>> ioStrides;
 
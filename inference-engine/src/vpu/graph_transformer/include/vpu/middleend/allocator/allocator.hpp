@@ -24,6 +24,7 @@ namespace vpu {
 struct UsedMemory final {
     int BSS = 0;
     int CMX = 0;
+    int CMXPeakLive = 0;
     int blob = 0;
     int input = 0;
     int output = 0;
@@ -73,6 +74,12 @@ public:
 
     void reset();
 
+    /**
+     * Collects the index of the last stage using each data node,
+     * the allocator uses it to pack chunks with close lifetimes together and to choose data to spill from CMX
+     */
+    void initLifetimes(const Model& model);
+
     /**
      * Allocates memory for single data node
      */
@@ -99,11 +106,13 @@ public:
     AllocatorForShaves& getAllocatorOfShaves() { return _allocatorOfShaves; }
 
 private:
-    allocator::MemChunk* allocateMem(MemoryType memType, int size, int inUse);
+    allocator::MemChunk* allocateMem(MemoryType memType, int size, int inUse, int lifetimeEnd);
     void freeMem(allocator::MemChunk* chunk);
 
     allocator::MemChunk* addNewChunk(allocator::MemoryPool& pool, MemoryType memType, int offset, int pointer, int size, int inUse);
-    allocator::MemChunk* checkMemPool(allocator::MemoryPool& pool, MemoryType memType, int size, int inUse);
+    allocator::MemChunk* checkMemPool(allocator::MemoryPool& pool, MemoryType memType, int size, int inUse, int lifetimeEnd);
+
+    int getLifetimeEnd(const Data& data) const;
 
     void extractDatas(MemoryType memType, const DataSet& from, DataVector& out) const;
 
@@ -126,6 +135,8 @@ private:
 
     DataMap<allocator::MemChunk*> _memChunksPerData;
 
+    DataMap<int> _lifetimeEnds;
+
     std::map<std::pair<DimVector, DimValues>, int> _staticShapeOffsets;
 
     int _blobMemOffset = 0;
@@ -5,7 +5,9 @@
 #pragma once
 
 #include <list>
+#include <map>
 #include <vector>
+#include <limits>
 
 #include <vpu/utils/enums.hpp>
 #include <vpu/utils/small_vector.hpp>
@@ -36,6 +38,9 @@ struct MemChunk final {
     int size = 0;
     int inUse = 0;
 
+    // index of the last stage using the chunk, used to place chunks freed together next to each other
+    int lifetimeEnd = std::numeric_limits<int>::max();
+
     std::list<MemChunk>::iterator _posInList;
 };
 
@@ -47,13 +52,21 @@ struct FreeMemory final {
 struct MemoryPool final {
     int curMemOffset = 0;
     int memUsed = 0;
+    // total size of simultaneously allocated chunks, memUsed - memPeakLive is lost to fragmentation
+    int memLive = 0;
+    int memPeakLive = 0;
     std::list<MemChunk> allocatedChunks;
+    // allocated chunks by offset, used to find neighbours of a free block
+    std::map<int, MemChunk*> chunksByOffset;
     SmallVector<FreeMemory> freePool;
 
     void clear() {
         curMemOffset = 0;
         memUsed = 0;
+        memLive = 0;
+        memPeakLive = 0;
         allocatedChunks.clear();
+        chunksByOffset.clear();
         freePool.clear();
     }
 };
@@ -21,9 +21,9 @@ namespace vpu {
 
 namespace HWTilingNS {
 
+// Describes stage geometry only, tilers are shared between stages with the same options,
+// so errors found during the search are attributed to a stage by the caller.
 struct ConvolutionOptions final {
-    const std::string _stageName;
-
     const DimValues _inputDims;
     const DimValues _outputDims;
     const DimValues _origOutputDims;
@@ -39,11 +39,11 @@ struct ConvolutionOptions final {
     const bool _withPool;
 
 public:
-    ConvolutionOptions(std::string stageName, const DimValues& inputDims, const DimValues& outputDims,
+    ConvolutionOptions(const DimValues& inputDims, const DimValues& outputDims,
                        const DimValues& origOutputDims, int kernelSizeX, int kernelSizeY,
                        int kernelStride, int paddingLeft, int paddingRight,
                        int paddingTop, int paddingBottom, bool withPool)
-            : _stageName(std::move(stageName)), _inputDims(inputDims), _outputDims(outputDims),
+            : _inputDims(inputDims), _outputDims(outputDims),
               _origOutputDims(origOutputDims), _kernelSizeX(kernelSizeX), _kernelSizeY(kernelSizeY),
               _kernelStride(kernelStride), _paddingLeft(paddingLeft), _paddingRight(paddingRight),
               _paddingTop(paddingTop), _paddingBottom(paddingBottom), _withPool(withPool) {}
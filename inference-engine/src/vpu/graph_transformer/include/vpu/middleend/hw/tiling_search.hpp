@@ -0,0 +1,39 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+#include <vpu/middleend/hw/pooling_tiling/hw_pooling_tiler.hpp>
+
+namespace vpu {
+
+namespace HWTilingNS {
+
+using HWConvolutionTilerPtr = std::shared_ptr<const HWConvolutionTiler>;
+using HWPoolingTilerPtr = std::shared_ptr<const HWPoolingTiler>;
+
+//
+// Tiling search depends only on the stage geometry and CMX resources of the compilation,
+// so its results are memoized per process and shared between stages and networks
+// with the same parameters.
+//
+
+HWConvolutionTilerPtr findConvolutionTiling(const ConvolutionOptions& convolutionOptions,
+                                            const Direction& direction, std::size_t maxTilingOptions);
+
+HWPoolingTilerPtr findPoolingTiling(const ConvolutionOptions& convolutionOptions,
+                                    const Direction& direction, std::size_t maxTilingOptions);
+
+// Runs search(i) for every i in [0, count) on the worker threads with the current CompileEnv visible in them.
+// The search must not modify the Model, the first exception thrown is rethrown in the calling thread.
+void parallelTilingSearch(std::size_t count, const std::function<void(std::size_t)>& search);
+
+}  // namespace HWTilingNS
+
+}  // namespace vpu
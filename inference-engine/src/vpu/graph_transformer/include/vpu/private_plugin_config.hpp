@@ -38,6 +38,13 @@ DECLARE_VPU_CONFIG(MYRIAD_PER_STAGE);
 DECLARE_VPU_CONFIG(MYRIAD_ENABLE_MEMORY_TYPES_ANNOTATION);
 DECLARE_VPU_CONFIG(MYRIAD_ENABLE_EARLY_ELTWISE_RELU_FUSION);
 
+/**
+ * @brief Used to order independent stages so that the ones releasing more memory
+ * are executed first, which reduces peak memory usage and spills from CMX to DDR.
+ * Default is "NO".
+ */
+DECLARE_VPU_CONFIG(MYRIAD_ENABLE_MEMORY_AWARE_STAGE_ORDER);
+
 /**
  * @brief Used to disable analyzeWeightableLayers pass in cases where
  * weights scaling leads to poor accuracy. Default = "YES"
@@ -138,6 +138,17 @@ void CompileEnv::free() {
     g_compileEnv = nullptr;
 }
 
+CompileEnv::ThreadScope::ThreadScope(const CompileEnv* env) : _prev(g_compileEnv) {
+    IE_ASSERT(env != nullptr);
+    IE_ASSERT(env->initialized);
+
+    g_compileEnv = const_cast<CompileEnv*>(env);
+}
+
+CompileEnv::ThreadScope::~ThreadScope() {
+    g_compileEnv = _prev;
+}
+
 //
 // compileNetwork
 //
@@ -8,6 +8,9 @@
 #include <algorithm>
 #include <limits>
 #include <set>
+#include <iterator>
+#include <cstdint>
+#include <cstdlib>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/model/model.hpp>
@@ -25,6 +28,7 @@ void printTo(std::ostream& os, const UsedMemory& usedMemory) {
 
     os << "BSS=" << usedMemory.BSS << std::endl;
     os << "CMX=" << usedMemory.CMX << std::endl;
+    os << "CMXPeakLive=" << usedMemory.CMXPeakLive << std::endl;
     os << "blob=" << usedMemory.blob << std::endl;
     os << "input=" << usedMemory.input << std::endl;
     os << "output=" << usedMemory.output << std::endl;
@@ -36,6 +40,7 @@ void printTo(DotLabel& lbl, const UsedMemory& usedMemory) {
     DotLabel subLbl(lbl);
     subLbl.appendPair("BSS", usedMemory.BSS);
     subLbl.appendPair("CMX", usedMemory.CMX);
+    subLbl.appendPair("CMXPeakLive", usedMemory.CMXPeakLive);
     subLbl.appendPair("blob", usedMemory.blob);
     subLbl.appendPair("input", usedMemory.input);
     subLbl.appendPair("output", usedMemory.output);
@@ -275,7 +280,7 @@ bool Allocator::allocateData(const Data& data) {
         "allocateData failed: data {} with usage {} isn't used by anything",
         data->name(), data->usage());
 
-    auto chunk = allocateMem(memoryType, finalByteSize, inUse);
+    auto chunk = allocateMem(memoryType, finalByteSize, inUse, getLifetimeEnd(data));
 
     if (chunk == nullptr) {
         return false;
@@ -420,10 +425,11 @@ void Allocator::freeData(const Data& data, DeallocationMode mode) {
 
             auto curChunkSz = chunk->size;
             auto inUse = chunk->inUse;
+            auto lifetimeEnd = chunk->lifetimeEnd;
 
             freeMem(chunk);
 
-            auto ddrChunk = allocateMem(MemoryType::DDR, curChunkSz, inUse);
+            auto ddrChunk = allocateMem(MemoryType::DDR, curChunkSz, inUse, lifetimeEnd);
             IE_ASSERT(ddrChunk!= nullptr);
 
             _memChunksPerData[data] = ddrChunk;
@@ -455,6 +461,7 @@ UsedMemory Allocator::usedMemoryAmount() const {
 
     stats.BSS = _ddrMemoryPool.memUsed;
     stats.CMX = _cmxMemoryPool.memUsed;
+    stats.CMXPeakLive = _cmxMemoryPool.memPeakLive;
     stats.blob = _blobMemOffset;
     stats.input = _inputMemOffset;
     stats.output = _outputMemOffset;
@@ -516,7 +523,7 @@ DataVector Allocator::getAllocatedDatas(MemoryType memType) const {
     return out;
 }
 
-allocator::MemChunk* Allocator::allocateMem(MemoryType memType, int size, int inUse) {
+allocator::MemChunk* Allocator::allocateMem(MemoryType memType, int size, int inUse, int lifetimeEnd) {
     VPU_THROW_UNLESS(size >= 0, "{} bytes to allocate have been requested, but only non-negative amount is supported", size);
     if (size == 0) {
         return nullptr;
@@ -528,8 +535,10 @@ allocator::MemChunk* Allocator::allocateMem(MemoryType memType, int size, int in
     // Try to reuse already allocated memory
     //
 
-    if (auto chunk = checkMemPool(*memPool, memType, size, inUse)) {
+    if (auto chunk = checkMemPool(*memPool, memType, size, inUse, lifetimeEnd)) {
         memPool->memUsed = std::max(memPool->memUsed, chunk->offset + chunk->size);
+        memPool->memLive += size;
+        memPool->memPeakLive = std::max(memPool->memPeakLive, memPool->memLive);
         return chunk;
     }
 
@@ -557,9 +566,13 @@ allocator::MemChunk* Allocator::allocateMem(MemoryType memType, int size, int in
     auto chunk = addNewChunk(*memPool, memType, memPool->curMemOffset, pointer, size, inUse);
     IE_ASSERT(chunk != nullptr);
 
+    chunk->lifetimeEnd = lifetimeEnd;
+
     memPool->curMemOffset += size;
 
     memPool->memUsed = std::max(memPool->memUsed, chunk->offset + chunk->size);
+    memPool->memLive += size;
+    memPool->memPeakLive = std::max(memPool->memPeakLive, memPool->memLive);
 
     return chunk;
 }
@@ -569,6 +582,8 @@ void Allocator::freeMem(allocator::MemChunk* chunk) {
 
     auto& memPool =  _memPools.at(chunk->memType);
 
+    memPool->memLive -= chunk->size;
+
     allocator::FreeMemory newMem;
     newMem.offset = chunk->offset;
     newMem.size = chunk->size;
@@ -619,6 +634,7 @@ void Allocator::freeMem(allocator::MemChunk* chunk) {
     }
 
     IE_ASSERT(chunk->_posInList != memPool->allocatedChunks.end());
+    memPool->chunksByOffset.erase(chunk->offset);
     memPool->allocatedChunks.erase(chunk->_posInList);
 }
 
@@ -634,10 +650,13 @@ allocator::MemChunk* Allocator::addNewChunk(allocator::MemoryPool& memPool, Memo
     auto newChunk = &memPool.allocatedChunks.back();
     newChunk->_posInList = it;
 
+    const auto inserted = memPool.chunksByOffset.emplace(offset, newChunk).second;
+    IE_ASSERT(inserted);
+
     return newChunk;
 }
 
-allocator::MemChunk* Allocator::checkMemPool(allocator::MemoryPool& memPool, MemoryType memType, int size, int inUse) {
+allocator::MemChunk* Allocator::checkMemPool(allocator::MemoryPool& memPool, MemoryType memType, int size, int inUse, int lifetimeEnd) {
     auto minMemSizeToUse = std::numeric_limits<size_t>::max();
     auto minMemIt = memPool.freePool.end();
 
@@ -656,6 +675,38 @@ allocator::MemChunk* Allocator::checkMemPool(allocator::MemoryPool& memPool, Mem
 
     auto offset = minMemIt->offset + minMemIt->size - size;
 
+    //
+    // Put the chunk next to the neighbour with the closest lifetime end:
+    // such chunks are likely to be freed together and merged back into a single free block.
+    //
+
+    if (minMemIt->size > size) {
+        const allocator::MemChunk* lowerNeighbour = nullptr;
+        const allocator::MemChunk* upperNeighbour = nullptr;
+
+        const auto upperIt = memPool.chunksByOffset.lower_bound(minMemIt->offset + minMemIt->size);
+        if (upperIt != memPool.chunksByOffset.end() && upperIt->first == minMemIt->offset + minMemIt->size) {
+            upperNeighbour = upperIt->second;
+        }
+        if (upperIt != memPool.chunksByOffset.begin()) {
+            const auto lowerChunk = std::prev(upperIt)->second;
+            if (lowerChunk->offset + lowerChunk->size == minMemIt->offset) {
+                lowerNeighbour = lowerChunk;
+            }
+        }
+
+        const auto lifetimeDistance = [lifetimeEnd](const allocator::MemChunk* neighbour) {
+            return neighbour == nullptr
+                ? std::numeric_limits<int64_t>::max()
+                : std::abs(static_cast<int64_t>(neighbour->lifetimeEnd) - lifetimeEnd);
+        };
+
+        if (lifetimeDistance(lowerNeighbour) < lifetimeDistance(upperNeighbour)) {
+            offset = minMemIt->offset;
+            minMemIt->offset += size;
+        }
+    }
+
     int pointer = 0;
     if (memType == MemoryType::DDR) {
         pointer = offset;
@@ -665,6 +716,7 @@ allocator::MemChunk* Allocator::checkMemPool(allocator::MemoryPool& memPool, Mem
     }
 
     auto chunk = addNewChunk(memPool, memType, offset, pointer, size, inUse);
+    chunk->lifetimeEnd = lifetimeEnd;
 
     minMemIt->size -= size;
 
@@ -690,6 +742,26 @@ void Allocator::reset() {
     _memChunksPerData.clear();
 }
 
+void Allocator::initLifetimes(const Model& model) {
+    _lifetimeEnds.clear();
+
+    for (const auto& stage : model->getStages()) {
+        for (const auto& input : stage->inputs()) {
+            auto& lifetimeEnd = _lifetimeEnds[input->getTopParentData()];
+            lifetimeEnd = std::max(lifetimeEnd, stage->index());
+        }
+
+        for (const auto& tempBuffer : stage->tempBuffers()) {
+            _lifetimeEnds[tempBuffer] = stage->index();
+        }
+    }
+}
+
+int Allocator::getLifetimeEnd(const Data& data) const {
+    const auto it = _lifetimeEnds.find(data->getTopParentData());
+    return it != _lifetimeEnds.end() ? it->second : std::numeric_limits<int>::max();
+}
+
 AllocationResult Allocator::preprocess(const Model& model) {
     reset();
 
@@ -749,27 +821,47 @@ bool Allocator::removeCMXCandidates(const vpu::Data& data) {
 
         return true;
     } else {
-        auto cmxDatas = getAllocatedDatas(MemoryType::CMX);
+        //
+        // Spill the candidate which is used the latest: it occupies CMX for the longest time,
+        // so moving it to DDR leaves the most room for the following stages.
+        //
 
-        for (const auto& cmxData : cmxDatas) {
-            IE_ASSERT(cmxData->parentDataToDataEdge() == nullptr);
+        Data spillData;
 
-            it = _candidatesForCMX.find(cmxData);
+        for (const auto& cmxData : getAllocatedDatas(MemoryType::CMX)) {
+            IE_ASSERT(cmxData->parentDataToDataEdge() == nullptr);
 
-            if (it != _candidatesForCMX.end()) {
-                freeData(cmxData, DeallocationMode::MoveFromCMX);
+            if (_candidatesForCMX.count(cmxData) == 0) {
+                continue;
+            }
 
-                loopOverData(cmxData, [](const Data& subData) {
-                    subData->setMemReqs(MemoryType::DDR);
-                    return DataLoopStatus::NextChild;
-                });
+            if (spillData == nullptr) {
+                spillData = cmxData;
+                continue;
+            }
 
-                _candidatesForCMX.erase(it);
+            const auto cmxDataLifetimeEnd = getLifetimeEnd(cmxData);
+            const auto spillDataLifetimeEnd = getLifetimeEnd(spillData);
 
-                // TODO: remove the first CMX candidate or remove all CMX candidates?
-                return true;
+            // compare names on equal lifetimes to keep the choice independent of the DataSet iteration order
+            if (cmxDataLifetimeEnd > spillDataLifetimeEnd ||
+                (cmxDataLifetimeEnd == spillDataLifetimeEnd && cmxData->name() < spillData->name())) {
+                spillData = cmxData;
             }
         }
+
+        if (spillData != nullptr) {
+            freeData(spillData, DeallocationMode::MoveFromCMX);
+
+            loopOverData(spillData, [](const Data& subData) {
+                subData->setMemReqs(MemoryType::DDR);
+                return DataLoopStatus::NextChild;
+            });
+
+            _candidatesForCMX.erase(spillData);
+
+            return true;
+        }
     }
 
     return false;
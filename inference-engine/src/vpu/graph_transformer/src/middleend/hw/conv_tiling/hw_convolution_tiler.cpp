@@ -306,16 +306,14 @@ bool GraphDataTiling::ceilNeeded() const {
 
     if ((_convolutionOptions._origOutputDims[Dim::W] != outWidthWithCeil) &&
         (_convolutionOptions._origOutputDims[Dim::W] != outWidthWithOutCeil)) {
-        VPU_THROW_EXCEPTION << "Internal error: Output in " << _convolutionOptions._stageName
-                            << " has incorrect width dimension. Expected: " << outWidthWithCeil << " or "
-                            << outWidthWithOutCeil << " Actual: " << _convolutionOptions._origOutputDims[Dim::W];
+        VPU_THROW_EXCEPTION << "Internal error: Output has incorrect width dimension. Expected: "
+                            << outWidthWithCeil << " or " << outWidthWithOutCeil << " Actual: " << _convolutionOptions._origOutputDims[Dim::W];
     }
 
     if ((_convolutionOptions._origOutputDims[Dim::H] != outHeightWithCeil) &&
         (_convolutionOptions._origOutputDims[Dim::H] != outHeightWithOutCeil)) {
-        VPU_THROW_EXCEPTION << "Internal error: Output in " << _convolutionOptions._stageName
-                            << " has incorrect height dimension. Expected: " << outHeightWithCeil << " or "
-                            << outHeightWithOutCeil << " Actual: " << _convolutionOptions._origOutputDims[Dim::H];
+        VPU_THROW_EXCEPTION << "Internal error: Output has incorrect height dimension. Expected: "
+                            << outHeightWithCeil << " or " << outHeightWithOutCeil << " Actual: " << _convolutionOptions._origOutputDims[Dim::H];
     }
 
     return ((_convolutionOptions._origOutputDims[Dim::W] == outWidthWithCeil) ||
@@ -140,17 +140,15 @@ private:
 
         if ((_convolutionOptions._outputDims[Dim::W] != outWidthWithCeil) &&
             (_convolutionOptions._outputDims[Dim::W] != outWidthWithOutCeil)) {
-            VPU_THROW_EXCEPTION << "Internal error: Output in " << _convolutionOptions._stageName
-                                << " has incorrect width dimension. Expected: " << outWidthWithCeil
-                                << " or " << outWidthWithOutCeil
+            VPU_THROW_EXCEPTION << "Internal error: Output has incorrect width dimension. Expected: "
+                                << outWidthWithCeil << " or " << outWidthWithOutCeil
                                 << " Actual: " << _convolutionOptions._outputDims[Dim::W];
         }
 
         if ((_convolutionOptions._outputDims[Dim::H] != outHeightWithCeil) &&
             (_convolutionOptions._outputDims[Dim::H] != outHeightWithOutCeil)) {
-            VPU_THROW_EXCEPTION << "Internal error: Output in " << _convolutionOptions._stageName
-                                << " has incorrect height dimension. Expected: " << outHeightWithCeil
-                                << " or " << outHeightWithOutCeil
+            VPU_THROW_EXCEPTION << "Internal error: Output has incorrect height dimension. Expected: "
+                                << outHeightWithCeil << " or " << outHeightWithOutCeil
                                 << " Actual: " << _convolutionOptions._outputDims[Dim::H];
         }
 
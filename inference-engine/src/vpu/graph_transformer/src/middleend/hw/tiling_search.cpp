@@ -0,0 +1,132 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/middleend/hw/tiling_search.hpp>
+
+#include <exception>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
+#include <vpu/compile_env.hpp>
+
+namespace vpu {
+
+namespace HWTilingNS {
+
+namespace {
+
+// protects against unbounded growth when a process compiles a lot of unrelated networks
+constexpr std::size_t MAX_CACHED_TILINGS = 4096;
+
+using TilingKey = std::vector<int>;
+
+TilingKey makeTilingKey(const ConvolutionOptions& options, const Direction& direction, std::size_t maxTilingOptions) {
+    const auto& env = CompileEnv::get();
+
+    TilingKey key{
+        static_cast<int>(direction),
+        static_cast<int>(maxTilingOptions),
+        env.resources.numCMXSlices,
+        env.resources.tilingCMXLimit,
+        options._kernelSizeX,
+        options._kernelSizeY,
+        options._kernelStride,
+        options._paddingLeft,
+        options._paddingRight,
+        options._paddingTop,
+        options._paddingBottom,
+        options._withPool ? 1 : 0
+    };
+
+    for (const auto dims : {&options._inputDims, &options._outputDims, &options._origOutputDims}) {
+        key.push_back(static_cast<int>(dims->size()));
+        for (const auto& dim : *dims) {
+            key.push_back(static_cast<int>(dim.first));
+            key.push_back(dim.second);
+        }
+    }
+
+    return key;
+}
+
+template <class Tiler>
+class TilerCache final {
+public:
+    std::shared_ptr<const Tiler> find(const ConvolutionOptions& options, const Direction& direction,
+                                      std::size_t maxTilingOptions) {
+        auto key = makeTilingKey(options, direction, maxTilingOptions);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            const auto it = _tilers.find(key);
+            if (it != _tilers.end()) {
+                return it->second;
+            }
+        }
+
+        // Search itself runs unlocked: concurrent searches for the same key produce equal tilers.
+        auto tiler = std::make_shared<const Tiler>(options, direction, maxTilingOptions);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_tilers.size() >= MAX_CACHED_TILINGS) {
+            _tilers.clear();
+        }
+        _tilers.emplace(std::move(key), tiler);
+
+        return tiler;
+    }
+
+private:
+    std::mutex _mutex;
+    std::map<TilingKey, std::shared_ptr<const Tiler>> _tilers;
+};
+
+}  // namespace
+
+HWConvolutionTilerPtr findConvolutionTiling(const ConvolutionOptions& convolutionOptions,
+                                            const Direction& direction, std::size_t maxTilingOptions) {
+    static TilerCache<HWConvolutionTiler> cache;
+    return cache.find(convolutionOptions, direction, maxTilingOptions);
+}
+
+HWPoolingTilerPtr findPoolingTiling(const ConvolutionOptions& convolutionOptions,
+                                    const Direction& direction, std::size_t maxTilingOptions) {
+    static TilerCache<HWPoolingTiler> cache;
+    return cache.find(convolutionOptions, direction, maxTilingOptions);
+}
+
+void parallelTilingSearch(std::size_t count, const std::function<void(std::size_t)>& search) {
+    if (count == 1) {
+        search(0);
+        return;
+    }
+
+    const auto* env = &CompileEnv::get();
+    std::vector<std::exception_ptr> errors(count);
+
+    // exceptions are not allowed to leave OpenMP parallel regions
+    ie::parallel_for(count, [&](std::size_t ind) {
+        CompileEnv::ThreadScope envScope(env);
+
+        try {
+            search(ind);
+        } catch (...) {
+            errors[ind] = std::current_exception();
+        }
+    });
+
+    for (const auto& error : errors) {
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}  // namespace HWTilingNS
+
+}  // namespace vpu
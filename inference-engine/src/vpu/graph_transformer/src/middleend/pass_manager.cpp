@@ -8,6 +8,10 @@
 #include <iomanip>
 #include <memory>
 #include <string>
+#include <vector>
+#include <unordered_map>
+#include <utility>
+#include <algorithm>
 
 #include <vpu/compile_env.hpp>
 
@@ -39,6 +43,11 @@ void PassSet::run(const Model& model) const {
     env.log->debug("MiddleEnd : Run passes");
     VPU_LOGGER_SECTION(env.log);
 
+    // accumulated per pass name, since some passes (like dumpModel) are added several times
+    std::vector<std::pair<std::string, double>> passDurations;
+    std::unordered_map<std::string, size_t> passDurationInds;
+    double totalDuration = 0.0;
+
     int passInd = 0;
     for (const auto& p : _passes) {
         env.log->debug("Start pass %m%d / %d [%s]", std::setw(2), passInd + 1, _passes.size(), p.second);
@@ -52,15 +61,38 @@ void PassSet::run(const Model& model) const {
 
         auto endTime = std::chrono::high_resolution_clock::now();
 
+        const auto duration = std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count();
+
         env.log->debug(
             "Pass %m%d / %d [%s] duration : %f ms",
-            std::setw(2), passInd + 1, _passes.size(), p.second,
-            std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count());
+            std::setw(2), passInd + 1, _passes.size(), p.second, duration);
+
+        const auto durationInd = passDurationInds.emplace(p.second, passDurations.size());
+        if (durationInd.second) {
+            passDurations.emplace_back(p.second, 0.0);
+        }
+        passDurations[durationInd.first->second].second += duration;
+        totalDuration += duration;
 
         ++passInd;
     }
 
     model->cleanUp();
+
+    if (env.log->isActive(LogLevel::Info)) {
+        std::stable_sort(passDurations.begin(), passDurations.end(),
+            [](const std::pair<std::string, double>& left, const std::pair<std::string, double>& right) {
+                return left.second > right.second;
+            });
+
+        const size_t maxReportedPasses = 10;
+        env.log->info("MiddleEnd : %d passes duration : %f ms, the slowest ones:", _passes.size(), totalDuration);
+        VPU_LOGGER_SECTION(env.log);
+
+        for (size_t ind = 0; ind < std::min(maxReportedPasses, passDurations.size()); ++ind) {
+            env.log->info("[%s] : %f ms", passDurations[ind].first, passDurations[ind].second);
+        }
+    }
 }
 
 //
@@ -146,28 +146,69 @@ void PassImpl::collectMemReqs(const Model& model) {
     }
 }
 
+namespace {
+
+// Bytes the stage allocates for its outputs minus bytes it releases as the only consumer of its inputs
+int calcStageMemoryDelta(const Stage& stage) {
+    int memoryDelta = 0;
+
+    for (const auto& output : stage->outputs()) {
+        const auto topParent = output->getTopParentData();
+        if (topParent == output && topParent->usage() == DataUsage::Intermediate) {
+            memoryDelta += calcAllocationSize(topParent);
+        }
+    }
+
+    for (const auto& input : stage->inputs()) {
+        const auto topParent = input->getTopParentData();
+        if (topParent == input && topParent->usage() == DataUsage::Intermediate && topParent->numConsumers() == 1) {
+            memoryDelta -= calcAllocationSize(topParent);
+        }
+    }
+
+    return memoryDelta;
+}
+
+}  // namespace
+
 void PassImpl::resetStageOrder(const Model& model) {
-    if (!CompileEnv::get().config.hwOptimization)
+    const auto& env = CompileEnv::get();
+
+    const bool hwOptimization = env.config.hwOptimization;
+    const bool memoryAwareOrder = env.config.enableMemoryAwareStageOrder;
+    if (!hwOptimization && !memoryAwareOrder)
         return;
 
     static const std::string s_expectCMXOutput {"expectCMXOutput"};
+    static const std::string s_memoryDelta {"memoryDelta"};
 
     for (const auto& stage : model->getStages()) {
-        if (stage->numOutputs() == 1 && stage->output(0)->memReqs() == MemoryType::CMX) {
+        if (hwOptimization && stage->numOutputs() == 1 && stage->output(0)->memReqs() == MemoryType::CMX) {
             stage->attrs().set(s_expectCMXOutput, true);
         }
+        if (memoryAwareOrder) {
+            stage->attrs().set<int>(s_memoryDelta, calcStageMemoryDelta(stage));
+        }
     }
     /*
      * Add an heuristic for allocation order: when data have a split or data with several consumers,
      * walk through DDR branch before CMX branch.
      * Empirically established that there will be less attempts to copy from CMX to DDR in graph.
+     * Optionally, among the rest walk first through the branch which releases more memory, to lower the peak usage.
      */
-    model->reorderStages([](const Stage& left, const Stage& right) {
+    model->reorderStages([memoryAwareOrder](const Stage& left, const Stage& right) {
         const bool leftExpectCMX  = left->attrs().getOrDefault(s_expectCMXOutput, false);
         const bool rightExpectCMX = right->attrs().getOrDefault(s_expectCMXOutput, false);
         if (leftExpectCMX != rightExpectCMX) {
             return rightExpectCMX;
         }
+        if (memoryAwareOrder) {
+            const auto leftMemoryDelta  = left->attrs().getOrDefault<int>(s_memoryDelta, 0);
+            const auto rightMemoryDelta = right->attrs().getOrDefault<int>(s_memoryDelta, 0);
+            if (leftMemoryDelta != rightMemoryDelta) {
+                return leftMemoryDelta < rightMemoryDelta;
+            }
+        }
         return left->id() < right->id();
     });
 }
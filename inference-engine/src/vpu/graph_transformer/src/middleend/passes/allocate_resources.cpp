@@ -35,6 +35,7 @@ AllocationResult runAllocator(const Model& model, EnableShapeAllocation enableSh
     //
 
     allocator.reset();
+    allocator.initLifetimes(model);
 
     //
     // Allocate Const/Input/Output datas.
@@ -278,7 +279,25 @@ void PassImpl::run(const Model& model) {
     // Allocation statistics
     //
 
-    model->attrs().set<UsedMemory>("usedMemory", allocator.usedMemoryAmount());
+    const auto usedMemory = allocator.usedMemoryAmount();
+
+    model->attrs().set<UsedMemory>("usedMemory", usedMemory);
+
+    const auto& env = CompileEnv::get();
+
+    if (env.log->isActive(LogLevel::Info)) {
+        const auto cmxSize = env.resources.numCMXSlices * CMX_SLICE_SIZE;
+
+        int numSpills = 0;
+        for (const auto& stage : model->getStages()) {
+            if (stage->attrs().getOrDefault<bool>("CMX-to-DDR", false)) {
+                ++numSpills;
+            }
+        }
+
+        env.log->info("Memory allocation : CMX used %d / %d bytes (%f%%), CMX peak live %d bytes, %d spills from CMX to DDR, BSS %d bytes",
+            usedMemory.CMX, cmxSize, 100.0 * usedMemory.CMX / cmxSize, usedMemory.CMXPeakLive, numSpills, usedMemory.BSS);
+    }
 }
 
 }  // namespace
@@ -8,6 +8,7 @@
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -16,6 +17,7 @@
 #include <vpu/middleend/hw/utility.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_stage_tiler.hpp>
+#include <vpu/middleend/hw/tiling_search.hpp>
 
 namespace vpu {
 
@@ -34,6 +36,13 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    std::vector<Stage> origStages;
+    std::vector<HWTilingNS::ConvolutionOptions> convolutionOptions;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -51,16 +60,8 @@ void PassImpl::run(const Model& model) {
         // Unsupported paddings
         //
 
-        //
-        // Try to find "best" tiling
-        //
-
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
-            origStage->name(),
+        origStages.push_back(origStage);
+        convolutionOptions.push_back(HWTilingNS::ConvolutionOptions{
             stageIO.origInput->desc().dims(),
             stageIO.origOutput->desc().dims(),
             stageIO.origOutputDesc.dims(),
@@ -72,33 +73,53 @@ void PassImpl::run(const Model& model) {
             stageOptions.padTop,
             stageOptions.padBottom,
             stageOptions.withPool
-        };
+        });
+    }
+
+    //
+    // Try to find "best" tiling, stages are independent so search for them in parallel
+    //
 
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
+    std::vector<HWTilingNS::HWConvolutionTilerPtr> tilers(origStages.size());
 
+    HWTilingNS::parallelTilingSearch(origStages.size(), [&](size_t ind) {
+        const auto& options = convolutionOptions[ind];
 
-        const HWTilingNS::HWConvolutionTiler& tiler = [&] {
-            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
+        // tilers are shared between stages of the same geometry, so the stage is named here
+        try {
+            auto tiler = HWTilingNS::findConvolutionTiling(options, direction, tilingsCount);
+
+            if (!tiler->isTilingPossible() && tiler->withPool()) {
                 const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
+                    options._inputDims,
+                    options._origOutputDims,
+                    options._origOutputDims,
+                    options._kernelSizeX,
+                    options._kernelSizeY,
+                    options._kernelStride,
+                    options._paddingLeft,
+                    options._paddingRight,
+                    options._paddingTop,
+                    options._paddingBottom,
                     false
                 };
 
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
-            } else {
-                return tiler1stAttempt;
+                tiler = HWTilingNS::findConvolutionTiling(optionsWithoutPool, direction, tilingsCount);
             }
-        }();
+
+            tilers[ind] = std::move(tiler);
+        } catch (const ie::details::InferenceEngineException& exception) {
+            VPU_THROW_EXCEPTION << origStages[ind]->name() << " of type " << origStages[ind]->type() << ": "
+                                << exception.what();
+        }
+    });
+
+    for (size_t ind = 0; ind < origStages.size(); ++ind) {
+        const auto& origStage = origStages[ind];
+        const auto& tiler = *tilers[ind];
+
+        const HWConvStageOptions stageOptions(origStage);
+        const HWConvStageIO stageIO(origStage, origStage->output(0));
 
         //
         // Use SW stage if tiling optimization failed
@@ -9,11 +9,13 @@
 #include <string>
 #include <utility>
 #include <memory>
+#include <vector>
 
 #include <vpu/stages/stub_stage.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 #include <vpu/middleend/hw/pooling_tiling/hw_pooling_tiler.hpp>
 #include <vpu/middleend/hw/pooling_tiling/hw_stage_tiler.hpp>
+#include <vpu/middleend/hw/tiling_search.hpp>
 
 namespace vpu {
 
@@ -32,6 +34,14 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwPoolTiling);
 
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction =
+            HWTilingNS::Direction::INPUT_TO_OUTPUT;
+    // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    std::vector<Stage> origStages;
+    std::vector<HWTilingNS::ConvolutionOptions> convolutionOptions;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubMaxPool &&
             origStage->type() != StageType::StubAvgPool) {
@@ -46,17 +56,8 @@ void PassImpl::run(const Model& model) {
         const HWPoolStageOptions stageOptions(origStage);
         const HWPoolStageIO stageIO(origStage, origStage->output(0));
 
-        //
-        // Try to find "best" tiling
-        //
-
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction =
-                HWTilingNS::Direction::INPUT_TO_OUTPUT;
-        // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
-            origStage->name(),
+        origStages.push_back(origStage);
+        convolutionOptions.push_back(HWTilingNS::ConvolutionOptions{
             stageIO.origInput->desc().dims(),
             stageIO.origOutput->desc().dims(),
             stageIO.origOutput->desc().dims(),
@@ -67,9 +68,31 @@ void PassImpl::run(const Model& model) {
             stageOptions.padRight,
             stageOptions.padTop,
             stageOptions.padBottom,
-            false};
+            false});
+    }
 
-        const HWTilingNS::HWPoolingTiler tiler(convolutionOptions, direction, tilingsCount);
+    //
+    // Try to find "best" tiling, stages are independent so search for them in parallel
+    //
+
+    std::vector<HWTilingNS::HWPoolingTilerPtr> tilers(origStages.size());
+
+    HWTilingNS::parallelTilingSearch(origStages.size(), [&](size_t ind) {
+        // tilers are shared between stages of the same geometry, so the stage is named here
+        try {
+            tilers[ind] = HWTilingNS::findPoolingTiling(convolutionOptions[ind], direction, tilingsCount);
+        } catch (const ie::details::InferenceEngineException& exception) {
+            VPU_THROW_EXCEPTION << origStages[ind]->name() << " of type " << origStages[ind]->type() << ": "
+                                << exception.what();
+        }
+    });
+
+    for (size_t ind = 0; ind < origStages.size(); ++ind) {
+        const auto& origStage = origStages[ind];
+        const auto& tiler = *tilers[ind];
+
+        const HWPoolStageOptions stageOptions(origStage);
+        const HWPoolStageIO stageIO(origStage, origStage->output(0));
 
         if (!tiler.isTilingPossible()) {
             origStage->attrs().set<bool>("tryHW", false);
@@ -69,6 +69,7 @@ IE_SUPPRESS_DEPRECATED_START
         ie::MYRIAD_DISABLE_CONVERT_STAGES,
         ie::MYRIAD_ENABLE_WEIGHTS_ANALYSIS,
         ie::MYRIAD_ENABLE_EARLY_ELTWISE_RELU_FUSION,
+        ie::MYRIAD_ENABLE_MEMORY_AWARE_STAGE_ORDER,
         ie::MYRIAD_ENABLE_CUSTOM_RESHAPE_PARAM,
 
         //
@@ -187,6 +188,7 @@ void ParsedConfig::parse(const std::map<std::string, std::string>& config) {
     setOption(_compileConfig.disableConvertStages,           switches, config, ie::MYRIAD_DISABLE_CONVERT_STAGES);
     setOption(_compileConfig.enableWeightsAnalysis,          switches, config, ie::MYRIAD_ENABLE_WEIGHTS_ANALYSIS);
     setOption(_compileConfig.enableEarlyEltwiseReLUFusion,   switches, config, ie::MYRIAD_ENABLE_EARLY_ELTWISE_RELU_FUSION);
+    setOption(_compileConfig.enableMemoryAwareStageOrder,    switches, config, ie::MYRIAD_ENABLE_MEMORY_AWARE_STAGE_ORDER);
     setOption(_compileConfig.enableCustomReshapeParam,       switches, config, ie::MYRIAD_ENABLE_CUSTOM_RESHAPE_PARAM);
 
     setOption(_compileConfig.irWithVpuScalesDir,                       config, ie::MYRIAD_IR_WITH_SCALES_DIRECTORY);
@@ -2,11 +2,15 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
 #include <fstream>
+#include <sstream>
 
+#include "common_test_utils/ngraph_test_utils.hpp"
 #include "gtest/gtest.h"
 #include "ie_core.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset1.hpp"
 #include "transformations/serialize.hpp"
 
 #ifndef IR_SERIALIZATION_MODELS_PATH  // should be already defined by cmake
@@ -55,3 +59,33 @@ TEST_F(SerializationTransformationTest, PassManagerInstantiation) {
     ASSERT_TRUE(xml.good());
     ASSERT_TRUE(bin.good());
 }
+
+TEST(SerializationConstantsTest, IdenticalConstantsAreWrittenOnce) {
+    const std::vector<float> values{1.f, 2.f, 3.f, 4.f};
+    auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4});
+    auto const1 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4}, values);
+    auto const2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4}, values);
+    auto const3 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4}, {4.f, 3.f, 2.f, 1.f});
+    auto add = std::make_shared<ngraph::opset1::Add>(data, const1);
+    auto mul = std::make_shared<ngraph::opset1::Multiply>(add, const2);
+    auto sub = std::make_shared<ngraph::opset1::Subtract>(mul, const3);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{sub}, ngraph::ParameterVector{data});
+
+    std::stringstream xml, bin;
+    ngraph::pass::Serialize(xml, bin).run_on_function(function);
+
+    // const1 and const2 share the same blob
+    ASSERT_EQ(bin.str().size(), 2 * values.size() * sizeof(float));
+
+    InferenceEngine::Core ie;
+    InferenceEngine::Blob::Ptr weights = InferenceEngine::make_shared_blob<uint8_t>(
+        InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {bin.str().size()}, InferenceEngine::Layout::C));
+    weights->allocate();
+    std::memcpy(weights->buffer().as<uint8_t*>(), bin.str().data(), bin.str().size());
+    auto result = ie.ReadNetwork(xml.str(), weights).getFunction();
+
+    const auto res = FunctionsComparator::with_default()
+                         .enable(FunctionsComparator::CONST_VALUES)
+                         .compare(result, function);
+    ASSERT_TRUE(res.valid) << res.message;
+}
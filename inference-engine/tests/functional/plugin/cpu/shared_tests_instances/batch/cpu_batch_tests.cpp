@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <batch/batch_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+TEST(smoke_BatchCPU, CoalescedRequestsMatchSingleRequests) {
+    constexpr int numRequests = 4;
+    Core ie;
+    CNNNetwork network{ngraph::builder::subgraph::makeSingleConv()};
+    auto referenceNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto batchNetwork = ie.LoadNetwork(network, std::string{"BATCH:"} + CommonTestUtils::DEVICE_CPU,
+                                       {{BATCH_CONFIG_KEY(SIZE), std::to_string(numRequests)},
+                                        {BATCH_CONFIG_KEY(TIMEOUT), "1000"}});
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+
+    std::vector<InferRequest> requests;
+    std::vector<Blob::Ptr> references;
+    for (int i = 0; i < numRequests; ++i) {
+        auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().at(inputName)->getTensorDesc(), 10, i);
+        auto referenceRequest = referenceNetwork.CreateInferRequest();
+        referenceRequest.SetBlob(inputName, input);
+        referenceRequest.Infer();
+        references.push_back(referenceRequest.GetBlob(outputName));
+
+        requests.push_back(batchNetwork.CreateInferRequest());
+        requests.back().SetBlob(inputName, input);
+    }
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (int i = 0; i < numRequests; ++i) {
+        ASSERT_EQ(StatusCode::OK, requests[i].Wait(IInferRequest::WaitMode::RESULT_READY));
+        FuncTestUtils::compareBlobs(requests[i].GetBlob(outputName), references[i]);
+    }
+
+    ASSERT_GT(batchNetwork.GetMetric(BATCH_METRIC_KEY(AVERAGE_BATCH_SIZE)).as<float>(), 1.f);
+    ASSERT_GE(batchNetwork.GetMetric(BATCH_METRIC_KEY(AVERAGE_QUEUEING_DELAY)).as<float>(), 0.f);
+}
+
+TEST(smoke_BatchCPU, PartialBatchIsExecutedAfterTimeout) {
+    Core ie;
+    CNNNetwork network{ngraph::builder::subgraph::makeSingleConv()};
+    auto batchNetwork = ie.LoadNetwork(network, std::string{"BATCH:"} + CommonTestUtils::DEVICE_CPU,
+                                       {{BATCH_CONFIG_KEY(SIZE), "8"}, {BATCH_CONFIG_KEY(TIMEOUT), "10"}});
+    auto request = batchNetwork.CreateInferRequest();
+    ASSERT_NO_THROW(request.Infer());
+    ASSERT_EQ(1.f, batchNetwork.GetMetric(BATCH_METRIC_KEY(AVERAGE_BATCH_SIZE)).as<float>());
+}
+
+TEST(smoke_BatchCPU, InputBlobWithDifferentLayoutIsRejected) {
+    Core ie;
+    CNNNetwork network{ngraph::builder::subgraph::makeSingleConv()};
+    auto batchNetwork = ie.LoadNetwork(network, std::string{"BATCH:"} + CommonTestUtils::DEVICE_CPU,
+                                       {{BATCH_CONFIG_KEY(SIZE), "2"}, {BATCH_CONFIG_KEY(TIMEOUT), "10"}});
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    const auto& dims = inputInfo->getTensorDesc().getDims();
+    // the same number of elements as the network input, but in a different layout
+    auto input = make_shared_blob<float>({Precision::FP32, {dims[0], dims[2], dims[3], dims[1]}, Layout::NHWC});
+    input->allocate();
+    auto request = batchNetwork.CreateInferRequest();
+    request.SetBlob(inputInfo->name(), input);
+    ASSERT_THROW(request.Infer(), details::InferenceEngineException);
+}
+
+}  // namespace
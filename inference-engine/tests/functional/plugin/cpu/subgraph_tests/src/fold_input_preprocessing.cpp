@@ -0,0 +1,76 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+CNNNetwork makeNetworkWithMeanValues(const std::vector<ptrdiff_t>& pads, float scale = 1.f) {
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 3, 16, 16}});
+    auto conv = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, pads, pads, {1, 1},
+                                                 ngraph::op::PadType::EXPLICIT, 8, true);
+    auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(conv)},
+                                                       params, "FoldInputPreprocessing");
+    CNNNetwork network{function};
+    auto input = network.getInputsInfo().begin()->second;
+    input->setPrecision(Precision::U8);
+    input->setLayout(Layout::NHWC);
+    auto& preProcess = input->getPreProcess();
+    preProcess.init(3);
+    const float means[] = {104.f, 117.f, 123.f};
+    for (size_t c = 0; c < 3; c++) {
+        preProcess[c]->meanValue = means[c];
+        preProcess[c]->stdScale = scale;
+    }
+    preProcess.setVariant(MEAN_VALUE);
+    return network;
+}
+
+void checkFoldedMatchesReference(const CNNNetwork& network) {
+    Core ie;
+    auto reference = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto folded = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                 {{PluginConfigParams::KEY_CPU_FOLD_PREPROCESSING, PluginConfigParams::YES}});
+    ASSERT_EQ(PluginConfigParams::YES, folded.GetConfig(PluginConfigParams::KEY_CPU_FOLD_PREPROCESSING).as<std::string>());
+
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().at(inputName)->getTensorDesc(), 255);
+
+    auto referenceRequest = reference.CreateInferRequest();
+    referenceRequest.SetBlob(inputName, input);
+    referenceRequest.Infer();
+
+    auto foldedRequest = folded.CreateInferRequest();
+    foldedRequest.SetBlob(inputName, input);
+    foldedRequest.Infer();
+
+    FuncTestUtils::compareBlobs(foldedRequest.GetBlob(outputName), referenceRequest.GetBlob(outputName));
+}
+
+TEST(smoke_FoldInputPreprocessingCPU, FoldedMeanValuesMatchSeparatePreprocessing) {
+    checkFoldedMatchesReference(makeNetworkWithMeanValues({0, 0}));
+}
+
+TEST(smoke_FoldInputPreprocessingCPU, PaddedConvolutionKeepsSeparatePreprocessing) {
+    checkFoldedMatchesReference(makeNetworkWithMeanValues({1, 1}));
+}
+
+TEST(smoke_FoldInputPreprocessingCPU, ScaledInputKeepsSeparatePreprocessing) {
+    checkFoldedMatchesReference(makeNetworkWithMeanValues({0, 0}, 0.5f));
+}
+
+}  // namespace
@@ -0,0 +1,89 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <hetero/hetero_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
+
+using namespace InferenceEngine;
+
+namespace {
+
+const std::vector<float> inputValues{0.f, 1.f, 2.f, 3.f, 4.f, 5.f};
+
+// Parameter -> Convert to intermediateType on CPU0 -> Convert back to f32 and Relu on CPU1, so the network is split
+// into two subgraphs loaded to different devices and the intermediate blob has intermediateType.
+// Relu replaces a Convert which would not change the type, so the subgraphs are never empty
+CNNNetwork makeConvertSplitNetwork(ngraph::element::Type intermediateType) {
+    auto setAffinity = [] (const std::shared_ptr<ngraph::Node>& node, const std::string& affinity) {
+        node->get_rt_info()["affinity"] = std::make_shared<ngraph::VariantWrapper<std::string>>(affinity);
+    };
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, inputValues.size()});
+    param->set_friendly_name("input");
+    std::shared_ptr<ngraph::Node> first = std::make_shared<ngraph::opset1::Relu>(param);
+    std::shared_ptr<ngraph::Node> second = first;
+    if (intermediateType != ngraph::element::f32) {
+        first = std::make_shared<ngraph::opset1::Convert>(param, intermediateType);
+        second = std::make_shared<ngraph::opset1::Convert>(first, ngraph::element::f32);
+        setAffinity(second, "CPU1");
+    }
+    setAffinity(first, "CPU0");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(second);
+    relu->set_friendly_name("output");
+    setAffinity(relu, "CPU1");
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{param},
+                                                       "ConvertSplit");
+    return CNNNetwork{function};
+}
+
+class HeteroIntermediateBlobsCPU : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ie.RegisterPlugin("MKLDNNPlugin", "CPU0");
+        ie.RegisterPlugin("MKLDNNPlugin", "CPU1");
+    }
+
+    std::vector<float> Infer(ExecutableNetwork& executableNetwork) {
+        auto request = executableNetwork.CreateInferRequest();
+        auto input = request.GetBlob("input");
+        std::copy(inputValues.begin(), inputValues.end(), input->buffer().as<float*>());
+        request.Infer();
+        auto output = request.GetBlob("output");
+        auto outputData = output->cbuffer().as<const float*>();
+        return {outputData, outputData + output->size()};
+    }
+
+    std::uint64_t EstimatedBytesCopied(const ExecutableNetwork& executableNetwork) {
+        return executableNetwork.GetMetric(HETERO_METRIC_KEY(ESTIMATED_BYTES_COPIED_PER_INFERENCE)).as<std::uint64_t>();
+    }
+
+    Core ie;
+};
+
+TEST_F(HeteroIntermediateBlobsCPU, smoke_FP32BlobIsNotCopied) {
+    auto executableNetwork = ie.LoadNetwork(makeConvertSplitNetwork(ngraph::element::f32), "HETERO:CPU0,CPU1");
+    ASSERT_EQ(inputValues, Infer(executableNetwork));
+    ASSERT_EQ(0, EstimatedBytesCopied(executableNetwork));
+}
+
+TEST_F(HeteroIntermediateBlobsCPU, smoke_I32BlobIsCopiedByProducerAndConsumer) {
+    auto executableNetwork = ie.LoadNetwork(makeConvertSplitNetwork(ngraph::element::i32), "HETERO:CPU0,CPU1");
+    ASSERT_EQ(inputValues, Infer(executableNetwork));
+    ASSERT_EQ(2 * inputValues.size() * sizeof(std::int32_t), EstimatedBytesCopied(executableNetwork));
+}
+
+// The producer output of u8 type is FP32, so the consumer input gets FP32 instead of U8 and the blob is shared
+TEST_F(HeteroIntermediateBlobsCPU, smoke_U8BlobGetsProducerPrecision) {
+    auto executableNetwork = ie.LoadNetwork(makeConvertSplitNetwork(ngraph::element::u8), "HETERO:CPU0,CPU1");
+    ASSERT_EQ(inputValues, Infer(executableNetwork));
+    ASSERT_EQ(0, EstimatedBytesCopied(executableNetwork));
+}
+
+}  // namespace
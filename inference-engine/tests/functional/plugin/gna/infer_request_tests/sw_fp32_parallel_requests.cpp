@@ -0,0 +1,85 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <gna/gna_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+constexpr size_t kParallelRequests = 4;
+constexpr size_t kRounds = 3;
+
+CNNNetwork makeAffineNetwork() {
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 64}});
+    auto fc1 = ngraph::builder::makeFullyConnected(params[0], ngraph::element::f32, 32);
+    auto sigmoid = std::make_shared<ngraph::opset1::Sigmoid>(fc1);
+    auto fc2 = ngraph::builder::makeFullyConnected(sigmoid, ngraph::element::f32, 16);
+    auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(fc2)},
+                                                       params, "SwFp32ParallelRequests");
+    return CNNNetwork{function};
+}
+
+std::map<std::string, std::string> swFp32Config(size_t threads) {
+    return {{GNAConfigParams::KEY_GNA_DEVICE_MODE, GNAConfigParams::GNA_SW_FP32},
+            {GNAConfigParams::KEY_GNA_LIB_N_THREADS, std::to_string(threads)}};
+}
+
+TEST(smoke_GnaSwFp32ParallelRequests, ParallelAsyncRequestsMatchSingleRequest) {
+    auto network = makeAffineNetwork();
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    const auto& inputDesc = network.getInputsInfo().at(inputName)->getTensorDesc();
+
+    std::vector<Blob::Ptr> inputs;
+    for (size_t i = 0; i < kParallelRequests; i++) {
+        inputs.push_back(FuncTestUtils::createAndFillBlob(inputDesc, 10, -5, 1, static_cast<int>(i + 1)));
+    }
+
+    Core ie;
+    // reference outputs computed one by one by a single request
+    auto single = ie.LoadNetwork(network, CommonTestUtils::DEVICE_GNA, swFp32Config(1));
+    auto singleRequest = single.CreateInferRequest();
+    std::vector<Blob::Ptr> references;
+    for (const auto& input : inputs) {
+        singleRequest.SetBlob(inputName, input);
+        singleRequest.Infer();
+        auto output = singleRequest.GetBlob(outputName);
+        auto reference = make_blob_with_precision(output->getTensorDesc());
+        reference->allocate();
+        std::copy_n(output->cbuffer().as<const uint8_t*>(), output->byteSize(), reference->buffer().as<uint8_t*>());
+        references.push_back(reference);
+    }
+
+    auto parallel = ie.LoadNetwork(network, CommonTestUtils::DEVICE_GNA, swFp32Config(kParallelRequests));
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < kParallelRequests; i++) {
+        requests.push_back(parallel.CreateInferRequest());
+        requests.back().SetBlob(inputName, inputs[i]);
+    }
+
+    // every request owns its copy of intermediate buffers, so results must not depend on the neighbours
+    for (size_t round = 0; round < kRounds; round++) {
+        for (auto& request : requests) {
+            request.StartAsync();
+        }
+        for (size_t i = 0; i < kParallelRequests; i++) {
+            ASSERT_EQ(StatusCode::OK, requests[i].Wait(IInferRequest::WaitMode::RESULT_READY));
+            FuncTestUtils::compareBlobs(requests[i].GetBlob(outputName), references[i], 0.f);
+        }
+    }
+}
+
+}  // namespace
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include <ie_core.hpp>
+#include <ie_compound_blob.h>
 #include <blob_factory.hpp>
 #include "common_test_utils/test_assertions.hpp"
 #include "common_test_utils/common_utils.hpp"
@@ -581,4 +582,59 @@ TEST_P(PreprocessTest, SetScalePreProcessSetBlob) {
     }
 }
 
+TEST_P(PreprocessTest, SetBatchedBlobOfDifferentSizesPreProcess) {
+    // Skip test according to plugin specific disabledTestPatterns() (if any)
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto makeNetwork = [](size_t batch) {
+        ngraph::PartialShape shape({batch, 3, 8, 8});
+        auto param = std::make_shared<ngraph::op::Parameter>(ngraph::element::f32, shape);
+        param->set_friendly_name("param");
+        auto relu = std::make_shared<ngraph::op::Relu>(param);
+        relu->set_friendly_name("relu");
+        auto result = std::make_shared<ngraph::op::Result>(relu);
+        result->set_friendly_name("result");
+
+        InferenceEngine::CNNNetwork cnnNet(std::make_shared<ngraph::Function>(ngraph::ResultVector{result},
+                                                                              ngraph::ParameterVector{param}));
+        auto input = cnnNet.getInputsInfo().begin()->second;
+        input->setPrecision(InferenceEngine::Precision::U8);
+        input->setLayout(InferenceEngine::Layout::NHWC);
+        input->getPreProcess().setResizeAlgorithm(InferenceEngine::ResizeAlgorithm::RESIZE_BILINEAR);
+        return cnnNet;
+    };
+
+    // images of different sizes, including one which matches the network's input
+    const std::vector<InferenceEngine::SizeVector> imageDims = {{1, 3, 12, 16}, {1, 3, 8, 8}, {1, 3, 20, 10}};
+    std::vector<InferenceEngine::Blob::Ptr> images;
+    for (size_t i = 0; i < imageDims.size(); i++) {
+        images.push_back(FuncTestUtils::createAndFillBlob(
+            {InferenceEngine::Precision::U8, imageDims[i], InferenceEngine::Layout::NHWC}, 250, static_cast<int32_t>(i)));
+    }
+
+    auto batchedNet = makeNetwork(images.size());
+    auto execNet = ie->LoadNetwork(batchedNet, targetDevice, configuration);
+    auto req = execNet.CreateInferRequest();
+    req.SetBlob("param", InferenceEngine::make_shared_blob<InferenceEngine::VariableSizeBatchedBlob>(images));
+    req.Infer();
+    auto outBlob = req.GetBlob(batchedNet.getOutputsInfo().begin()->first);
+
+    auto singleNet = makeNetwork(1);
+    auto singleExecNet = ie->LoadNetwork(singleNet, targetDevice, configuration);
+    auto singleReq = singleExecNet.CreateInferRequest();
+    const size_t imageSize = outBlob->size() / images.size();
+    for (size_t i = 0; i < images.size(); i++) {
+        singleReq.SetBlob("param", images[i]);
+        singleReq.Infer();
+        auto refBlob = singleReq.GetBlob(singleNet.getOutputsInfo().begin()->first);
+
+        auto refMem = refBlob->cbuffer();
+        const auto* refData = refMem.as<const float*>();
+        auto outMem = outBlob->cbuffer();
+        const auto* outData = outMem.as<const float*>() + i * imageSize;
+        ASSERT_EQ(imageSize, refBlob->size());
+        for (size_t j = 0; j < imageSize; j++)
+            ASSERT_EQ(refData[j], outData[j]) << "image " << i << ", element " << j;
+    }
+}
+
 }  // namespace BehaviorTestsDefinitions
@@ -0,0 +1,82 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include <ngraph_ops/convolution_ie.hpp>
+#include <legacy/ie_layers.h>
+#include <legacy/convert_function_to_cnn_network.hpp>
+#include <preprocess_folding.h>
+
+using namespace InferenceEngine;
+
+namespace {
+
+const float kMeans[] = {104.f, 117.f, 123.f};
+
+CNNNetwork createNetWithMeanValues(float scale) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4, 4});
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{2, 3, 1, 1},
+                                                    std::vector<float>{1.f, 1.f, 1.f, 1.f, 0.f, -1.f});
+    auto conv = std::make_shared<ngraph::op::ConvolutionIE>(input, weights, ngraph::Strides{1, 1}, ngraph::Strides{1, 1},
+                                                            ngraph::CoordinateDiff{0, 0}, ngraph::CoordinateDiff{0, 0},
+                                                            ngraph::element::f32);
+    auto func = std::make_shared<ngraph::Function>(ngraph::NodeVector{conv}, ngraph::ParameterVector{input});
+
+    CNNNetwork ngNet(func);
+    CNNNetwork net{details::convertFunctionToICNNNetwork(func, ngNet)};
+    auto &preProcess = net.getInputsInfo().begin()->second->getPreProcess();
+    preProcess.init(3);
+    for (size_t c = 0; c < 3; c++) {
+        preProcess[c]->meanValue = kMeans[c];
+        preProcess[c]->stdScale = scale;
+    }
+    preProcess.setVariant(MEAN_VALUE);
+    return net;
+}
+
+ConvolutionLayer *getConvolution(const CNNNetwork &net) {
+    auto data = net.getInputsInfo().begin()->second->getInputData();
+    return dynamic_cast<ConvolutionLayer *>(getInputTo(data).begin()->second.get());
+}
+
+}  // namespace
+
+TEST(PreprocessFoldingTest, MeanValuesAreFoldedIntoBiases) {
+    auto net = createNetWithMeanValues(1.f);
+    auto conv = getConvolution(net);
+    ASSERT_NE(nullptr, conv);
+    auto weights = conv->blobs["weights"];
+
+    ASSERT_EQ(1, MKLDNNPlugin::FoldInputPreprocessing(net));
+
+    const auto &preProcess = net.getInputsInfo().begin()->second->getPreProcess();
+    EXPECT_EQ(NONE, preProcess.getMeanVariant());
+    EXPECT_EQ(0, preProcess.getNumberOfChannels());
+
+    EXPECT_EQ(weights, conv->blobs["weights"]);
+    ASSERT_EQ(1, conv->blobs.count("biases"));
+    const float *biases = conv->blobs["biases"]->cbuffer().as<const float *>();
+    EXPECT_FLOAT_EQ(-(kMeans[0] + kMeans[1] + kMeans[2]), biases[0]);
+    EXPECT_FLOAT_EQ(-(kMeans[0] - kMeans[2]), biases[1]);
+}
+
+TEST(PreprocessFoldingTest, ScaledInputIsNotFolded) {
+    auto net = createNetWithMeanValues(0.5f);
+    auto conv = getConvolution(net);
+    ASSERT_NE(nullptr, conv);
+    auto blobs = conv->blobs;
+
+    ASSERT_EQ(0, MKLDNNPlugin::FoldInputPreprocessing(net));
+
+    const auto &preProcess = net.getInputsInfo().begin()->second->getPreProcess();
+    EXPECT_EQ(MEAN_VALUE, preProcess.getMeanVariant());
+    EXPECT_EQ(3, preProcess.getNumberOfChannels());
+    EXPECT_EQ(blobs, conv->blobs);
+}
@@ -22,7 +22,8 @@ const std::map<std::string, std::string>  supportedConfigKeysWithDefaults = {
     {GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN), CONFIG_VALUE(NO)},
     {CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(NO)},
     {GNA_CONFIG_KEY(LIB_N_THREADS), "1"},
-    {CONFIG_KEY(SINGLE_THREAD), CONFIG_VALUE(YES)}
+    {CONFIG_KEY(SINGLE_THREAD), CONFIG_VALUE(YES)},
+    {CONFIG_KEY(CACHE_DIR), ""}
 };
 
 class GNAPluginConfigTest : public ::testing::Test {
@@ -169,6 +170,20 @@ TEST_F(GNAPluginConfigTest, GnaConfigLibNThreadsTest) {
     ExpectThrow(GNA_CONFIG_KEY(LIB_N_THREADS), "abc");
 }
 
+TEST_F(GNAPluginConfigTest, GnaConfigLibNThreadsWithSwFp32Test) {
+    SetAndCompare(GNA_CONFIG_KEY(DEVICE_MODE), GNAConfigParams::GNA_SW_FP32);
+    SetAndCompare(GNA_CONFIG_KEY(LIB_N_THREADS), "4");
+    EXPECT_TRUE(config.gnaFlags.sw_fp32);
+    EXPECT_EQ(config.gnaFlags.gna_lib_async_threads_num, 4);
+}
+
+TEST_F(GNAPluginConfigTest, GnaConfigCacheDirTest) {
+    SetAndCompare(CONFIG_KEY(CACHE_DIR), "gna_cache");
+    EXPECT_EQ(config.cacheDir, "gna_cache");
+    SetAndCompare(CONFIG_KEY(CACHE_DIR), "");
+    EXPECT_TRUE(config.cacheDir.empty());
+}
+
 TEST_F(GNAPluginConfigTest, GnaConfigSingleThreadTest) {
     SetAndCheckFlag(CONFIG_KEY(SINGLE_THREAD),
                     config.gnaFlags.gna_openmp_multithreading,
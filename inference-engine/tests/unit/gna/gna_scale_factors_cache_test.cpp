@@ -0,0 +1,109 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <legacy/layer_transform.hpp>
+#include "frontend/quantized_layer_params.hpp"
+#include "frontend/scale_factors_cache.hpp"
+
+using namespace InferenceEngine;
+using namespace GNAPluginNS;
+
+IE_SUPPRESS_DEPRECATED_START
+
+class GNAScaleFactorsCacheTest : public ::testing::Test {
+ protected:
+    static std::vector<CNNLayerPtr> makeNet(const std::string &activation = "sigmoid") {
+        auto input = std::make_shared<CNNLayer>(LayerParams{"input", "Input", Precision::FP32});
+        auto fc = std::make_shared<CNNLayer>(LayerParams{"fc", "FullyConnected", Precision::FP32});
+        fc->params["out-size"] = "8";
+        auto act = std::make_shared<CNNLayer>(LayerParams{"act", "Activation", Precision::FP32});
+        act->params["type"] = activation;
+        return {injectData<QuantizedLayerParams>(input),
+                injectData<QuantizedLayerParams>(fc),
+                injectData<QuantizedLayerParams>(act)};
+    }
+
+    void TearDown() override {
+        std::remove(("gna_sf_" + key + ".blob").c_str());
+    }
+
+    std::string key;
+};
+
+TEST_F(GNAScaleFactorsCacheTest, canStoreAndLoadScaleFactors) {
+    ScaleFactorsCache cache(".");
+    auto net = makeNet();
+    key = ScaleFactorsCache::GetKey(net, {2048.f}, "I16");
+    getInjectedData<QuantizedLayerParams>(net[0])->_dst_quant.SetScale(2048.f);
+    getInjectedData<QuantizedLayerParams>(net[1])->_weights_quant.SetScale(16.f);
+    getInjectedData<QuantizedLayerParams>(net[2])->_dst_quant.SetScale(4096.f);
+    cache.Store(key, net);
+
+    auto loadedNet = makeNet();
+    ASSERT_EQ(key, ScaleFactorsCache::GetKey(loadedNet, {2048.f}, "I16"));
+    ASSERT_TRUE(cache.Load(key, loadedNet));
+
+    auto inputQuant = getInjectedData<QuantizedLayerParams>(loadedNet[0]);
+    EXPECT_TRUE(inputQuant->_dst_quant.IsScaleSet());
+    EXPECT_FLOAT_EQ(inputQuant->_dst_quant.GetScale(), 2048.f);
+    EXPECT_FALSE(inputQuant->_src_quant.IsScaleSet());
+    EXPECT_FLOAT_EQ(getInjectedData<QuantizedLayerParams>(loadedNet[1])->_weights_quant.GetScale(), 16.f);
+    EXPECT_FLOAT_EQ(getInjectedData<QuantizedLayerParams>(loadedNet[2])->_dst_quant.GetScale(), 4096.f);
+}
+
+TEST_F(GNAScaleFactorsCacheTest, canStoreAndLoadQuantizationRanges) {
+    ScaleFactorsCache cache(".");
+    auto net = makeNet();
+    key = ScaleFactorsCache::GetKey(net, {2048.f}, "I16");
+    auto fcQuant = getInjectedData<QuantizedLayerParams>(net[1]);
+    fcQuant->_weights_quant.SetScale(16.f);
+    fcQuant->_weights_quant.SetLevels(255);
+    fcQuant->_weights_quant.SetMinValues({-1.f, -2.f});
+    fcQuant->_weights_quant.SetMaxValues({1.f, 2.f});
+    cache.Store(key, net);
+
+    auto loadedNet = makeNet();
+    ASSERT_TRUE(cache.Load(key, loadedNet));
+
+    const auto &weightsQuant = getInjectedData<QuantizedLayerParams>(loadedNet[1])->_weights_quant;
+    EXPECT_FLOAT_EQ(weightsQuant.GetScale(), 16.f);
+    EXPECT_EQ(weightsQuant.GetLevels(), 255);
+    EXPECT_EQ(weightsQuant.GetMinValues(), std::vector<float>({-1.f, -2.f}));
+    EXPECT_EQ(weightsQuant.GetMaxValues(), std::vector<float>({1.f, 2.f}));
+}
+
+TEST_F(GNAScaleFactorsCacheTest, keyDependsOnNetworkAndConfiguration) {
+    auto net = makeNet();
+    key = ScaleFactorsCache::GetKey(net, {2048.f}, "I16");
+    EXPECT_NE(key, ScaleFactorsCache::GetKey(makeNet("tanh"), {2048.f}, "I16"));
+    EXPECT_NE(key, ScaleFactorsCache::GetKey(net, {1024.f}, "I16"));
+    EXPECT_NE(key, ScaleFactorsCache::GetKey(net, {2048.f}, "I8"));
+
+    auto netWithRanges = makeNet();
+    getInjectedData<QuantizedLayerParams>(netWithRanges[1])->_dst_quant.SetLevels(65535);
+    EXPECT_NE(key, ScaleFactorsCache::GetKey(netWithRanges, {2048.f}, "I16"));
+}
+
+TEST_F(GNAScaleFactorsCacheTest, doesNotLoadEntryNotCoveringAllLayers) {
+    ScaleFactorsCache cache(".");
+    auto net = makeNet();
+    key = ScaleFactorsCache::GetKey(net, {2048.f}, "I16");
+    cache.Store(key, net);
+
+    auto otherNet = makeNet();
+    otherNet[2]->name = "other_act";
+    ASSERT_FALSE(cache.Load(key, otherNet));
+}
+
+TEST_F(GNAScaleFactorsCacheTest, missingEntryIsNotLoaded) {
+    ScaleFactorsCache cache(".");
+    auto net = makeNet();
+    key = ScaleFactorsCache::GetKey(net, {2048.f}, "I16");
+    ASSERT_FALSE(cache.Load(key, net));
+}
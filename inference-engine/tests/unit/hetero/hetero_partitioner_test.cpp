@@ -0,0 +1,139 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <details/ie_exception.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "hetero_partitioner.hpp"
+
+using namespace HeteroPlugin;
+
+namespace {
+
+// param -> first (Relu) -> heavy (MatMul with 256x256 weights) -> last (Relu) -> result
+std::shared_ptr<ngraph::Function> makeFunction() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 256});
+    auto first = std::make_shared<ngraph::opset1::Relu>(param);
+    first->set_friendly_name("first");
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{256, 256}, {1.f});
+    auto heavy = std::make_shared<ngraph::opset1::MatMul>(first, weights);
+    heavy->set_friendly_name("heavy");
+    auto last = std::make_shared<ngraph::opset1::Relu>(heavy);
+    last->set_friendly_name("last");
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{last}, ngraph::ParameterVector{param});
+}
+
+class HeteroPartitionerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // heavy takes 0.16us on FAST and 0.66us on SLOW, moving it there and back transfers 2048 bytes in 0.2us
+        costModel.deviceGops = {{"FAST", 400}, {"SLOW", 100}};
+    }
+
+    PartitionPlan partition(const std::map<std::string, std::set<std::string>>& supportedDevices,
+                            std::size_t maxSubgraphs = 0) {
+        return PartitionByCost(function->get_ordered_ops(), devices, supportedDevices, costModel, maxSubgraphs);
+    }
+
+    std::shared_ptr<ngraph::Function> function = makeFunction();
+    const std::vector<std::string> devices = {"FAST", "SLOW"};
+    CostModel costModel;
+};
+
+}  // namespace
+
+TEST_F(HeteroPartitionerTest, canAssignAllOperationsToFirstDevice) {
+    auto plan = partition({{"first", {"FAST", "SLOW"}}, {"heavy", {"FAST", "SLOW"}}, {"last", {"FAST", "SLOW"}}});
+
+    ASSERT_EQ(3, plan.affinities.size());
+    for (auto&& affinity : plan.affinities) {
+        EXPECT_EQ("FAST", affinity.second) << affinity.first;
+    }
+    EXPECT_EQ(1, plan.subgraphs);
+}
+
+TEST_F(HeteroPartitionerTest, canMoveHeavyOperationToFasterDevice) {
+    auto plan = partition({{"first", {"SLOW"}}, {"heavy", {"FAST", "SLOW"}}, {"last", {"SLOW"}}});
+
+    EXPECT_EQ("SLOW", plan.affinities.at("first"));
+    EXPECT_EQ("FAST", plan.affinities.at("heavy"));
+    EXPECT_EQ("SLOW", plan.affinities.at("last"));
+    EXPECT_EQ(3, plan.subgraphs);
+}
+
+TEST_F(HeteroPartitionerTest, canKeepHeavyOperationOnSlowerDeviceIfTransferCostDominates) {
+    costModel.transferGBps = 1;
+    auto plan = partition({{"first", {"SLOW"}}, {"heavy", {"FAST", "SLOW"}}, {"last", {"SLOW"}}});
+
+    for (auto&& affinity : plan.affinities) {
+        EXPECT_EQ("SLOW", affinity.second) << affinity.first;
+    }
+    EXPECT_EQ(1, plan.subgraphs);
+}
+
+TEST_F(HeteroPartitionerTest, costIsEstimatedTimeInMicroseconds) {
+    auto plan = partition({{"first", {"FAST"}}, {"heavy", {"FAST"}}, {"last", {"FAST"}}});
+
+    EXPECT_NEAR(256 * 256 / 400e3, plan.costs.at("heavy"), 1e-9);
+    EXPECT_NEAR(256 / 400e3, plan.costs.at("first"), 1e-9);
+    EXPECT_NEAR((256 * 256 + 2 * 256) / 400e3, plan.totalCost, 1e-9);
+}
+
+TEST_F(HeteroPartitionerTest, equalThroughputsPreferEarlierDevice) {
+    costModel.deviceGops.clear();
+    auto plan = partition({{"first", {"FAST", "SLOW"}}, {"heavy", {"FAST", "SLOW"}}, {"last", {"FAST", "SLOW"}}});
+
+    for (auto&& affinity : plan.affinities) {
+        EXPECT_EQ("FAST", affinity.second) << affinity.first;
+    }
+}
+
+TEST_F(HeteroPartitionerTest, throwsIfThroughputIsNotPositive) {
+    costModel.deviceGops["SLOW"] = 0;
+    ASSERT_THROW(partition({{"first", {"SLOW"}}, {"heavy", {"FAST", "SLOW"}}, {"last", {"SLOW"}}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(HeteroPartitionerTest, canKeepOperationsOnOneDeviceWithSubgraphLimit) {
+    auto plan = partition({{"first", {"SLOW"}}, {"heavy", {"FAST", "SLOW"}}, {"last", {"SLOW"}}}, 2);
+
+    for (auto&& affinity : plan.affinities) {
+        EXPECT_EQ("SLOW", affinity.second) << affinity.first;
+    }
+    EXPECT_EQ(1, plan.subgraphs);
+}
+
+TEST_F(HeteroPartitionerTest, limitAboveBestPlanDoesNotChangeIt) {
+    const std::map<std::string, std::set<std::string>> supportedDevices =
+        {{"first", {"SLOW"}}, {"heavy", {"FAST", "SLOW"}}, {"last", {"SLOW"}}};
+    auto unlimited = partition(supportedDevices);
+    auto limited = partition(supportedDevices, 3);
+
+    EXPECT_EQ(unlimited.affinities, limited.affinities);
+    EXPECT_EQ(unlimited.subgraphs, limited.subgraphs);
+    EXPECT_EQ(unlimited.totalCost, limited.totalCost);
+}
+
+TEST_F(HeteroPartitionerTest, throwsIfSubgraphLimitCannotBeMet) {
+    ASSERT_THROW(partition({{"first", {"SLOW"}}, {"heavy", {"FAST"}}, {"last", {"SLOW"}}}, 2),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(HeteroPartitionerTest, errorNamesUnsupportedOperation) {
+    try {
+        partition({{"first", {"FAST"}}, {"last", {"FAST"}}});
+        FAIL() << "Unsupported operation was assigned";
+    } catch (const InferenceEngine::details::InferenceEngineException& exception) {
+        EXPECT_NE(std::string::npos, std::string{exception.what()}.find("heavy of type MatMul"));
+    }
+}
@@ -47,6 +47,8 @@ public:
 
 class NV12BlobTests : public CompoundBlobTests {};
 class I420BlobTests : public CompoundBlobTests {};
+class BatchedBlobTests : public CompoundBlobTests {};
+class VariableSizeBatchedBlobTests : public CompoundBlobTests {};
 
 TEST(BlobConversionTests, canWorkWithMemoryBlob) {
     Blob::Ptr blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
@@ -424,4 +426,33 @@ TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithWrongHeightRatio) {
     EXPECT_THROW(make_shared_blob<I420Blob>(y_blob, v_blob, u_blob), InferenceEngine::details::InferenceEngineException);
 }
 
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromImagesOfDifferentSize) {
+    Blob::Ptr image0 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NHWC));
+    Blob::Ptr image1 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 10, 4}, NHWC));
 
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs{image0, image1}), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(VariableSizeBatchedBlobTests, canCreateVariableSizeBatchedBlobFromImagesOfDifferentSize) {
+    Blob::Ptr image0 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NHWC));
+    Blob::Ptr image1 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 10, 4}, NHWC));
+    VariableSizeBatchedBlob::Ptr batched_blob = make_shared_blob<VariableSizeBatchedBlob>(BlobPtrs{image0, image1});
+    verifyCompoundBlob(batched_blob, {image0, image1});
+    EXPECT_EQ(SizeVector({2, 3, 6, 8}), batched_blob->getTensorDesc().getDims());
+}
+
+TEST_F(VariableSizeBatchedBlobTests, cannotCreateVariableSizeBatchedBlobFromImagesWithDifferentChannels) {
+    Blob::Ptr image0 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NHWC));
+    Blob::Ptr image1 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC));
+
+    EXPECT_THROW(make_shared_blob<VariableSizeBatchedBlob>(BlobPtrs{image0, image1}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(VariableSizeBatchedBlobTests, cannotCreateVariableSizeBatchedBlobFromImagesWithDifferentLayouts) {
+    Blob::Ptr image0 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NHWC));
+    Blob::Ptr image1 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NCHW));
+
+    EXPECT_THROW(make_shared_blob<VariableSizeBatchedBlob>(BlobPtrs{image0, image1}),
+                 InferenceEngine::details::InferenceEngineException);
+}
@@ -0,0 +1,121 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef _WIN32
+
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "common_test_utils/test_common.hpp"
+#include "details/ie_irelease.hpp"
+#include "ie_blob.h"
+
+#include "shared_memory_allocator.hpp"
+
+using namespace InferenceEngine;
+
+class SharedMemoryAllocatorTests : public CommonTestUtils::TestsCommon {
+protected:
+    std::shared_ptr<IAllocator> createAllocator(const std::string& name, bool create, size_t offset = 0) {
+        return details::shared_from_irelease(CreateSharedMemoryAllocator(name.c_str(), create, offset));
+    }
+
+    const std::string shmName = "/ie_shm_test_" + std::to_string(getpid());
+};
+
+TEST_F(SharedMemoryAllocatorTests, canRelease) {
+    SharedMemoryAllocator *allocator_ = new SharedMemoryAllocator(shmName, true, 0);
+    allocator_->Release();
+}
+
+TEST_F(SharedMemoryAllocatorTests, canAllocateAndFreeNamedObject) {
+    auto allocator = createAllocator(shmName, true);
+    ASSERT_NE(nullptr, allocator);
+    void *handle = allocator->alloc(10000);
+    ASSERT_NE(nullptr, handle);
+    char *ptr = static_cast<char *>(allocator->lock(handle));
+    ptr[9999] = 11;
+    EXPECT_EQ(ptr[9999], 11);
+    allocator->unlock(handle);
+    EXPECT_TRUE(allocator->free(handle));
+    EXPECT_TRUE(allocator->free(nullptr));
+}
+
+TEST_F(SharedMemoryAllocatorTests, cannotCreateExistingObject) {
+    auto allocator = createAllocator(shmName, true);
+    void *handle = allocator->alloc(100);
+    ASSERT_NE(nullptr, handle);
+    EXPECT_EQ(nullptr, createAllocator(shmName, true)->alloc(100));
+    allocator->free(handle);
+}
+
+TEST_F(SharedMemoryAllocatorTests, canMapExistingObjectWithOffset) {
+    auto owner = createAllocator(shmName, true);
+    void *ownerHandle = owner->alloc(10000);
+    ASSERT_NE(nullptr, ownerHandle);
+    auto data = static_cast<char *>(owner->lock(ownerHandle));
+    data[5000] = 42;
+
+    auto reader = createAllocator(shmName, false, 5000);
+    void *readerHandle = reader->alloc(5000);
+    ASSERT_NE(nullptr, readerHandle);
+    auto view = static_cast<char *>(reader->lock(readerHandle));
+    EXPECT_EQ(42, view[0]);
+    view[1] = 24;
+    EXPECT_EQ(24, data[5001]);
+
+    // object is too small for the mapping
+    EXPECT_EQ(nullptr, reader->alloc(5001));
+
+    EXPECT_TRUE(reader->free(readerHandle));
+    EXPECT_TRUE(owner->free(ownerHandle));
+    EXPECT_EQ(nullptr, reader->alloc(10));
+}
+
+TEST_F(SharedMemoryAllocatorTests, anonymousMemoryIsSharedWithForkedProcess) {
+    auto allocator = createAllocator("", true);
+    void *handle = allocator->alloc(sizeof(int));
+    ASSERT_NE(nullptr, handle);
+    auto value = static_cast<int *>(allocator->lock(handle));
+    *value = 0;
+    pid_t pid = fork();
+    ASSERT_NE(-1, pid);
+    if (pid == 0) {
+        *value = 7;
+        _exit(0);
+    }
+    waitpid(pid, nullptr, 0);
+    EXPECT_EQ(7, *value);
+    allocator->free(handle);
+}
+
+TEST_F(SharedMemoryAllocatorTests, canMakeBlobOverSharedMemory) {
+    TensorDesc desc(Precision::FP32, {1, 16}, Layout::NC);
+    auto owner = make_shared_blob<float>(desc, createAllocator(shmName, true));
+    owner->allocate();
+    ASSERT_NE(nullptr, owner->data());
+    owner->data()[3] = 1.5f;
+
+    auto blob = make_shared_memory_blob<float>(TensorDesc(Precision::FP32, {1, 4}, Layout::NC), shmName,
+                                               2 * sizeof(float));
+    EXPECT_EQ(1.5f, blob->data()[1]);
+    EXPECT_THROW(make_shared_memory_blob<float>(desc, shmName, sizeof(float)), details::InferenceEngineException);
+}
+
+TEST_F(SharedMemoryAllocatorTests, cannotMakeBlobAtMisalignedOffset) {
+    TensorDesc desc(Precision::FP32, {1, 16}, Layout::NC);
+    auto owner = make_shared_blob<float>(desc, createAllocator(shmName, true));
+    owner->allocate();
+    ASSERT_NE(nullptr, owner->data());
+
+    // data() would return a misaligned float pointer
+    EXPECT_THROW(make_shared_memory_blob<float>(TensorDesc(Precision::FP32, {1, 4}, Layout::NC), shmName, 2),
+                 details::InferenceEngineException);
+    EXPECT_NO_THROW(make_shared_memory_blob<uint8_t>(TensorDesc(Precision::U8, {1, 4}, Layout::NC), shmName, 2));
+}
+
+#endif  // _WIN32
@@ -0,0 +1,145 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <multi-device/multi_device_config.hpp>
+
+#include "unit_test_utils/mocks/mock_iexecutable_network.hpp"
+#include "unit_test_utils/mocks/mock_iinfer_request.hpp"
+
+#include "multi_device_exec_network.hpp"
+
+using testing::_;
+using testing::DoAll;
+using testing::Invoke;
+using testing::Return;
+using testing::SaveArg;
+using testing::SetArgReferee;
+
+using namespace MultiDevicePlugin;
+
+namespace {
+
+// The only infer request of a device. It completes only when the test calls its completion callback
+struct MockWorker {
+    std::shared_ptr<MockIInferRequest>  request = std::make_shared<MockIInferRequest>();
+    void*                               userData = nullptr;
+    IInferRequest::CompletionCallback   callback = nullptr;
+};
+
+class MultiSchedulingTest : public ::testing::Test {
+protected:
+    // devices are listed in the priority order
+    void CreateNetwork(const std::vector<std::string>& deviceNames) {
+        DeviceMap<ExecutableNetwork> networks;
+        std::vector<DeviceInformation> devices;
+        for (auto&& deviceName : deviceNames) {
+            auto& worker = workers[deviceName];
+            EXPECT_CALL(*worker.request, SetUserData(_, _))
+                .WillRepeatedly(DoAll(SaveArg<0>(&worker.userData), Return(StatusCode::OK)));
+            EXPECT_CALL(*worker.request, GetUserData(_, _))
+                .WillRepeatedly(DoAll(Invoke([&worker] (void** data, ResponseDesc*) { *data = worker.userData; }),
+                                      Return(StatusCode::OK)));
+            EXPECT_CALL(*worker.request, SetCompletionCallback(_))
+                .WillRepeatedly(DoAll(SaveArg<0>(&worker.callback), Return(StatusCode::OK)));
+            EXPECT_CALL(*worker.request, StartAsync(_)).WillRepeatedly(Return(StatusCode::OK));
+
+            auto network = std::make_shared<MockIExecutableNetwork>();
+            EXPECT_CALL(*network, GetMetric(_, _, _))
+                .WillRepeatedly(DoAll(SetArgReferee<1>(Parameter{1u}), Return(StatusCode::OK)));
+            EXPECT_CALL(*network, CreateInferRequest(_, _))
+                .WillOnce(DoAll(SetArgReferee<0>(IInferRequest::Ptr{worker.request}), Return(StatusCode::OK)));
+            networks.emplace(deviceName, ExecutableNetwork{network});
+            devices.push_back({deviceName, {}, -1});
+        }
+        multiNetwork = std::make_shared<MultiDeviceExecutableNetwork>(networks, devices,
+            std::unordered_map<std::string, Parameter>{
+                {MULTI_CONFIG_KEY(SCHEDULING_POLICY), std::string{MULTI_CONFIG_VALUE(EARLIEST_COMPLETION)}}});
+    }
+
+    // the task records the device of the worker request it was scheduled to
+    void Submit() {
+        multiNetwork->run([this] {
+            auto workerRequest = MultiDeviceExecutableNetwork::_thisWorkerInferRequest;
+            for (auto&& deviceRequests : multiNetwork->_workerRequests) {
+                if (&deviceRequests.second.front() == workerRequest) {
+                    started.push_back(deviceRequests.first);
+                }
+            }
+            workerRequest->_task = [] {};
+            workerRequest->_inferRequest.StartAsync();
+        });
+    }
+
+    void Complete(const std::string& deviceName) {
+        auto& worker = workers.at(deviceName);
+        ASSERT_NE(nullptr, worker.callback);
+        worker.callback(worker.request, StatusCode::OK);
+    }
+
+    // runs one request on every device, so the latency of SLOW is known to be much higher than the one of FAST
+    void WarmUp() {
+        Submit();
+        Submit();
+        ASSERT_EQ((std::vector<std::string>{"SLOW", "FAST"}), started);
+        Complete("FAST");
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        Complete("SLOW");
+        started.clear();
+    }
+
+    std::map<std::string, MockWorker>               workers;
+    std::shared_ptr<MultiDeviceExecutableNetwork>   multiNetwork;
+    std::vector<std::string>                        started;
+};
+
+}  // namespace
+
+TEST_F(MultiSchedulingTest, devicesWithUnknownLatencyAreTriedInPriorityOrder) {
+    CreateNetwork({"SLOW", "FAST"});
+    Submit();
+    Submit();
+    Submit();
+
+    EXPECT_EQ((std::vector<std::string>{"SLOW", "FAST"}), started);
+}
+
+TEST_F(MultiSchedulingTest, idleDeviceWithEarliestCompletionIsPreferred) {
+    CreateNetwork({"SLOW", "FAST"});
+    WarmUp();
+    Submit();
+
+    EXPECT_EQ((std::vector<std::string>{"FAST"}), started);
+}
+
+TEST_F(MultiSchedulingTest, slowerDeviceIsNotLeftIdleWhileFasterIsBusy) {
+    CreateNetwork({"SLOW", "FAST"});
+    WarmUp();
+    Submit();
+    Submit();
+
+    EXPECT_EQ((std::vector<std::string>{"FAST", "SLOW"}), started);
+}
+
+TEST_F(MultiSchedulingTest, waitingRequestIsTakenByFirstDeviceWhichBecomesIdle) {
+    CreateNetwork({"SLOW", "FAST"});
+    WarmUp();
+    Submit();
+    Submit();
+    Submit();
+    ASSERT_EQ((std::vector<std::string>{"FAST", "SLOW"}), started);
+
+    Complete("SLOW");
+    EXPECT_EQ((std::vector<std::string>{"FAST", "SLOW", "SLOW"}), started);
+}
@@ -0,0 +1,176 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/middleend/allocator/allocator.hpp>
+
+#include "graph_transformer_tests.hpp"
+
+namespace vpu {
+
+namespace {
+
+struct DataLifetime final {
+    int byteSize;
+    int lifetimeEnd;
+};
+
+}  // namespace
+
+class VPU_LifetimeAwareAllocatorTest : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+    }
+
+    //
+    // Stage 0 produces all the datas, the following stages form a chain and the stage with index
+    // lifetimeEnd is the last consumer of the data, so the data lifetimes are known to the allocator.
+    //
+
+    DataVector CreateDatas(const std::vector<DataLifetime>& infos, MemoryType memType) {
+        m_testModel = CreateTestModel();
+        m_testModel.createInputs();
+        m_testModel.createOutputs();
+
+        std::vector<OutputInfo> firstStageOutputs;
+        int lastStageInd = 1;
+        for (const auto& info : infos) {
+            firstStageOutputs.push_back(OutputInfo::intermediate(DataDesc{info.byteSize / static_cast<int>(sizeof(fp16_t))}));
+            lastStageInd = std::max(lastStageInd, info.lifetimeEnd);
+        }
+        const auto chainOutputInd = static_cast<int>(infos.size());
+        firstStageOutputs.push_back(OutputInfo::intermediate(DataDesc{1}));
+        m_testModel.addStage({InputInfo::fromNetwork()}, firstStageOutputs);
+
+        for (int stageInd = 1; stageInd <= lastStageInd; stageInd++) {
+            std::vector<InputInfo> inputs{InputInfo::fromPrevStage(stageInd - 1, stageInd == 1 ? chainOutputInd : 0)};
+            for (int dataInd = 0; dataInd < static_cast<int>(infos.size()); dataInd++) {
+                if (infos[dataInd].lifetimeEnd == stageInd) {
+                    inputs.push_back(InputInfo::fromPrevStage(0, dataInd));
+                }
+            }
+            m_testModel.addStage(inputs, {stageInd == lastStageInd ? OutputInfo::fromNetwork() : OutputInfo::intermediate(DataDesc{1})});
+        }
+
+        DataVector datas;
+        for (int dataInd = 0; dataInd < static_cast<int>(infos.size()); dataInd++) {
+            const auto& data = m_testModel.getStages().front()->output(dataInd);
+            data->setMemReqs(memType);
+            datas.push_back(data);
+        }
+
+        auto& allocator = m_testModel.getBaseModel()->getAllocator();
+        allocator.reset();
+        allocator.initLifetimes(m_testModel.getBaseModel());
+
+        return datas;
+    }
+
+    Allocator& GetAllocator() {
+        return m_testModel.getBaseModel()->getAllocator();
+    }
+
+    void AllocateAll(std::initializer_list<Data> datas) {
+        for (const auto& data : datas) {
+            ASSERT_TRUE(GetAllocator().allocateData(data));
+        }
+    }
+
+protected:
+    TestModel m_testModel;
+};
+
+//
+// [A: 0..128) [free: 128..384) [C: 384..512)
+// The new chunk goes next to the neighbour which is freed closer to it.
+//
+
+TEST_F(VPU_LifetimeAwareAllocatorTest, ChunkIsPlacedNextToLowerNeighbourWithCloserLifetime) {
+    const auto datas = CreateDatas({{128, 5}, {256, 1}, {128, 2}, {128, 5}}, MemoryType::DDR);
+    const auto& a = datas[0];
+    const auto& b = datas[1];
+    const auto& c = datas[2];
+    const auto& x = datas[3];
+
+    ASSERT_NO_FATAL_FAILURE(AllocateAll({a, b, c}));
+    ASSERT_EQ(a->dataLocation().offset, 0);
+    ASSERT_EQ(b->dataLocation().offset, 128);
+    ASSERT_EQ(c->dataLocation().offset, 384);
+
+    GetAllocator().freeData(b);
+
+    ASSERT_TRUE(GetAllocator().allocateData(x));
+    ASSERT_EQ(x->dataLocation().location, Location::BSS);
+    ASSERT_EQ(x->dataLocation().offset, 128);
+}
+
+TEST_F(VPU_LifetimeAwareAllocatorTest, ChunkIsPlacedNextToUpperNeighbourWithCloserLifetime) {
+    const auto datas = CreateDatas({{128, 5}, {256, 1}, {128, 2}, {128, 2}}, MemoryType::DDR);
+    const auto& a = datas[0];
+    const auto& b = datas[1];
+    const auto& c = datas[2];
+    const auto& y = datas[3];
+
+    ASSERT_NO_FATAL_FAILURE(AllocateAll({a, b, c}));
+
+    GetAllocator().freeData(b);
+
+    ASSERT_TRUE(GetAllocator().allocateData(y));
+    ASSERT_EQ(y->dataLocation().location, Location::BSS);
+    ASSERT_EQ(y->dataLocation().offset, 256);
+}
+
+TEST_F(VPU_LifetimeAwareAllocatorTest, SpillsCMXCandidateUsedTheLatest) {
+    const auto datas = CreateDatas({{128, 1}, {128, 4}, {128, 3}, {128, 2}}, MemoryType::CMX);
+    const auto& p = datas[0];
+    const auto& q = datas[1];
+    const auto& r = datas[2];
+    const auto& failed = datas[3];
+
+    ASSERT_NO_FATAL_FAILURE(AllocateAll({p, q, r}));
+
+    auto& candidates = GetAllocator().getCandidatesForCMX();
+    candidates.insert(p);
+    candidates.insert(q);
+    candidates.insert(r);
+
+    ASSERT_TRUE(GetAllocator().removeCMXCandidates(failed));
+
+    ASSERT_EQ(q->memReqs(), MemoryType::DDR);
+    ASSERT_EQ(q->dataLocation().location, Location::BSS);
+    ASSERT_EQ(candidates.count(q), 0);
+
+    for (const auto& data : {p, r}) {
+        ASSERT_EQ(data->memReqs(), MemoryType::CMX);
+        ASSERT_EQ(data->dataLocation().location, Location::CMX);
+        ASSERT_EQ(candidates.count(data), 1);
+    }
+}
+
+//
+// [P: 0..128) [Q: 128..256) [R: 256..384), then P and R are freed and T does not fit into the hole left by P,
+// so CMX usage grows to 512 bytes while no more than 384 bytes are allocated at the same time.
+//
+
+TEST_F(VPU_LifetimeAwareAllocatorTest, ReportsCMXPeakLiveSeparatelyFromFragmentation) {
+    const auto datas = CreateDatas({{128, 1}, {128, 3}, {128, 1}, {256, 3}}, MemoryType::CMX);
+    const auto& p = datas[0];
+    const auto& q = datas[1];
+    const auto& r = datas[2];
+    const auto& t = datas[3];
+
+    ASSERT_NO_FATAL_FAILURE(AllocateAll({p, q, r}));
+
+    GetAllocator().freeData(p);
+    GetAllocator().freeData(r);
+
+    ASSERT_TRUE(GetAllocator().allocateData(t));
+
+    const auto usedMemory = GetAllocator().usedMemoryAmount();
+    ASSERT_EQ(usedMemory.CMX, 512);
+    ASSERT_EQ(usedMemory.CMXPeakLive, 384);
+}
+
+} // namespace vpu
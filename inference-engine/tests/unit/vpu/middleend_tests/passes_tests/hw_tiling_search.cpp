@@ -0,0 +1,88 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <vpu/middleend/hw/tiling_search.hpp>
+
+namespace vpu {
+
+class HwTilingSearchTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+    }
+
+    static HWTilingNS::ConvolutionOptions convOptions(int inputSize, bool withPool = false) {
+        const auto inputDims = DimValues{{Dim::W, inputSize}, {Dim::H, inputSize}, {Dim::C, 256}, {Dim::N, 1}};
+        const auto outputDims = DimValues{{Dim::W, inputSize}, {Dim::H, inputSize}, {Dim::C, 256}, {Dim::N, 1}};
+
+        return HWTilingNS::ConvolutionOptions{inputDims, outputDims, outputDims, 3, 3, 1, 1, 1, 1, 1, withPool};
+    }
+
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+};
+
+TEST_F(HwTilingSearchTests, SameGeometryIsSearchedOnce) {
+    const auto tiler1 = HWTilingNS::findConvolutionTiling(convOptions(112), direction, 1);
+    const auto tiler2 = HWTilingNS::findConvolutionTiling(convOptions(112), direction, 1);
+    const auto tiler3 = HWTilingNS::findConvolutionTiling(convOptions(56), direction, 1);
+
+    ASSERT_TRUE(tiler1->isTilingPossible());
+    ASSERT_EQ(tiler1, tiler2);
+    ASSERT_NE(tiler1, tiler3);
+}
+
+TEST_F(HwTilingSearchTests, CachedTilingMatchesDirectSearch) {
+    const auto options = convOptions(200);
+
+    const auto cached = HWTilingNS::findConvolutionTiling(options, direction, 1);
+    const HWTilingNS::HWConvolutionTiler direct(options, direction, 1);
+
+    ASSERT_EQ(cached->isTilingPossible(), direct.isTilingPossible());
+    ASSERT_EQ(cached->getHwTilings().size(), direct.getHwTilings().size());
+    for (size_t ind = 0; ind < direct.getHwTilings().size(); ++ind) {
+        const auto& expected = direct.getHwTilings()[ind];
+        const auto& actual = cached->getHwTilings()[ind];
+        ASSERT_EQ(actual->sohTiles, expected->sohTiles);
+        ASSERT_EQ(actual->sowTiles, expected->sowTiles);
+        ASSERT_EQ(actual->socTiles, expected->socTiles);
+    }
+}
+
+TEST_F(HwTilingSearchTests, ParallelSearchSeesCompileEnv) {
+    const size_t count = 16;
+    std::vector<HWTilingNS::HWConvolutionTilerPtr> tilers(count);
+
+    ASSERT_NO_THROW(HWTilingNS::parallelTilingSearch(count, [&](size_t ind) {
+        tilers[ind] = HWTilingNS::findConvolutionTiling(
+            convOptions(32 + 8 * static_cast<int>(ind)), direction, 1);
+    }));
+
+    for (size_t ind = 0; ind < count; ++ind) {
+        ASSERT_NE(tilers[ind], nullptr);
+        ASSERT_EQ(tilers[ind], HWTilingNS::findConvolutionTiling(
+            convOptions(32 + 8 * static_cast<int>(ind)), direction, 1));
+    }
+}
+
+TEST_F(HwTilingSearchTests, ParallelSearchRethrowsError) {
+    std::atomic<int> visited{0};
+
+    ASSERT_THROW(HWTilingNS::parallelTilingSearch(8, [&](size_t ind) {
+        ++visited;
+        if (ind == 5) {
+            throw std::runtime_error("search failed");
+        }
+    }), std::runtime_error);
+
+    ASSERT_EQ(visited, 8);
+}
+
+}  // namespace vpu
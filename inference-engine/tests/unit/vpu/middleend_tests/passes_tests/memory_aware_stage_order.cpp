@@ -0,0 +1,76 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+namespace vpu {
+
+//
+//                                -> (Grow) -> [Data 2] -> (Grow next) -> [Output 1]
+// [Input] -> (First) -> [Data 1]
+//                                -> (Release) -> [Output 2]
+//
+// (Grow) allocates [Data 2] while (Release) allocates nothing, [Data 1] is kept alive by both of them.
+// The default order follows the creation order of the stages, the memory aware one runs (Release) first.
+//
+
+class VPU_MemoryAwareStageOrderTest : public GraphTransformerTest, public testing::WithParamInterface<bool> {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        config.enableMemoryAwareStageOrder = GetParam();
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+
+        const DataDesc dataDesc(DataType::FP16, DimsOrder::NCHW, {16, 16, 8, 1});
+
+        model = CreateModel();
+
+        auto input = model->addInputData("Input", dataDesc);
+        model->attrs().set<int>("numInputs", 1);
+
+        auto output1 = model->addOutputData("Output 1", dataDesc);
+        auto output2 = model->addOutputData("Output 2", dataDesc);
+        model->attrs().set<int>("numOutputs", 2);
+
+        auto data1 = model->addNewData("Data 1", dataDesc);
+        auto data2 = model->addNewData("Data 2", dataDesc);
+
+        first = stageBuilder->addSoftMaxStage(model, "First", nullptr, input, data1, Dim::W);
+        grow = stageBuilder->addSoftMaxStage(model, "Grow", nullptr, data1, data2, Dim::W);
+        growNext = stageBuilder->addSoftMaxStage(model, "Grow next", nullptr, data2, output1, Dim::W);
+        release = stageBuilder->addSoftMaxStage(model, "Release", nullptr, data1, output2, Dim::W);
+
+        PassSet pipeline;
+        pipeline.addPass(passManager->dumpModel("initial"));
+        pipeline.addPass(passManager->adjustDataLayout());
+        pipeline.addPass(passManager->dumpModel("adjustDataLayout"));
+        pipeline.addPass(passManager->adjustDataLocation());
+        pipeline.addPass(passManager->dumpModel("adjustDataLocation"));
+
+        pipeline.run(model);
+    }
+
+protected:
+    Model model;
+    Stage first;
+    Stage grow;
+    Stage growNext;
+    Stage release;
+};
+
+TEST_P(VPU_MemoryAwareStageOrderTest, StageReleasingMemoryRunsFirstOnlyWhenEnabled) {
+    const auto memoryAwareOrder = GetParam();
+
+    // stage indices are assigned by the stage order
+    model->getStages();
+
+    ASSERT_LT(first->index(), grow->index());
+    ASSERT_LT(first->index(), release->index());
+    ASSERT_LT(grow->index(), growNext->index());
+    ASSERT_EQ(memoryAwareOrder, release->index() < grow->index());
+}
+
+INSTANTIATE_TEST_CASE_P(unit, VPU_MemoryAwareStageOrderTest, testing::Bool());
+
+} // namespace vpu
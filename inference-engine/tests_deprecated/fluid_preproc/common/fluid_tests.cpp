@@ -1189,7 +1189,10 @@ TEST_P(PreprocTest, Performance)
         cv::cvtColorTwoPlane(ocv_out_mat, in_mat2, ocv_out_mat, toCvtColorCode(in_fmt, out_fmt));
     }
 
-    auto cv_interp = interp == RESIZE_AREA ? cv::INTER_AREA : cv::INTER_LINEAR;
+    auto cv_interp = interp == RESIZE_AREA    ? cv::INTER_AREA
+                   : interp == RESIZE_NEAREST ? cv::INTER_NEAREST_EXACT
+                   : interp == RESIZE_BICUBIC ? cv::INTER_CUBIC
+                   : cv::INTER_LINEAR;
     cv::resize(ocv_out_mat, ocv_out_mat, out_size, 0, 0, cv_interp);
 
     if (in_prec != out_prec) {
@@ -1205,7 +1208,9 @@ TEST_P(PreprocTest, Performance)
     const auto in_type_str  = depthToString(precision_to_depth(in_prec));
     const auto out_type_str = depthToString(precision_to_depth(out_prec));
     const auto interp_str = interp == RESIZE_AREA ? "AREA"
-        : interp == RESIZE_BILINEAR ? "BILINEAR" : "?";
+        : interp == RESIZE_BILINEAR ? "BILINEAR"
+        : interp == RESIZE_NEAREST ? "NEAREST"
+        : interp == RESIZE_BICUBIC ? "BICUBIC" : "?";
     const auto in_layout_str = layoutToString(in_layout);
     const auto out_layout_str = layoutToString(out_layout);
 
@@ -1223,3 +1228,49 @@ TEST_P(PreprocTest, Performance)
 #endif // PERF_TEST
 
 }
+
+TEST_P(PreprocLetterboxTest, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    ResizeAlgorithm interp;
+    Layout out_layout;
+    std::pair<cv::Size, cv::Size> sizes;
+    std::tie(interp, out_layout, sizes) = GetParam();
+
+    cv::Size in_size, out_size;
+    std::tie(in_size, out_size) = sizes;
+    const float pad_value = 114.f;
+
+    initMatrixRandU(CV_8UC3, in_size, CV_8UC3, false);
+    cv::Mat out_mat(out_size, CV_8UC3);
+
+    auto in_blob  = img2Blob<Precision::U8>(in_mat1, Layout::NHWC);
+    auto out_blob = img2Blob<Precision::U8>(out_mat, out_layout);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(interp);
+    info.setResizeMode(RESIZE_LETTERBOX, pad_value);
+    preprocess->execute(out_blob, info, false);
+
+    Blob2Img<Precision::U8>(out_blob, out_mat, out_layout);
+
+    // reference: resize keeping aspect ratio into the centered part of a padded image
+    const double scale = std::min(static_cast<double>(out_size.width) / in_size.width,
+                                  static_cast<double>(out_size.height) / in_size.height);
+    const int w = std::max(1, std::min(out_size.width,  static_cast<int>(std::lround(in_size.width * scale))));
+    const int h = std::max(1, std::min(out_size.height, static_cast<int>(std::lround(in_size.height * scale))));
+    const cv::Rect content((out_size.width - w) / 2, (out_size.height - h) / 2, w, h);
+
+    auto cv_interp = interp == RESIZE_AREA    ? cv::INTER_AREA
+                   : interp == RESIZE_NEAREST ? cv::INTER_NEAREST_EXACT
+                   : interp == RESIZE_BICUBIC ? cv::INTER_CUBIC
+                   : cv::INTER_LINEAR;
+    cv::Mat ocv_out_mat(out_size, CV_8UC3, cv::Scalar::all(pad_value));
+    cv::Mat ocv_content = ocv_out_mat(content);
+    cv::resize(in_mat1, ocv_content, content.size(), 0, 0, cv_interp);
+
+    EXPECT_LE(cv::norm(ocv_out_mat, out_mat, cv::NORM_INF), 1);
+}
@@ -68,4 +68,8 @@ using PreprocParams = std::tuple< std::pair<InferenceEngine::Precision     // in
 
 struct PreprocTest: public TestParams<PreprocParams> {};
 
+struct PreprocLetterboxTest: public TestParams<std::tuple<InferenceEngine::ResizeAlgorithm,
+                                                          InferenceEngine::Layout,   // output tensor layout
+                                                          std::pair<cv::Size, cv::Size>>> {};
+
 #endif //FLUID_TESTS_HPP
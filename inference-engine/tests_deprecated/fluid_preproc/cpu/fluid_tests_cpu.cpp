@@ -366,6 +366,16 @@ INSTANTIATE_TEST_CASE_P(Everything_Resize, PreprocTest,
                                        std::make_pair(4, 4)),
                                 Values(TEST_SIZES_PREPROC)));
 
+INSTANTIATE_TEST_CASE_P(Nearest_Bicubic_Resize, PreprocTest,
+                        Combine(PRECISIONS,
+                                Values(IE::ResizeAlgorithm::RESIZE_NEAREST, IE::ResizeAlgorithm::RESIZE_BICUBIC),
+                                Values(IE::ColorFormat::RAW),
+                                Values(IE::Layout::NHWC, IE::Layout::NCHW),
+                                Values(IE::Layout::NHWC, IE::Layout::NCHW),
+                                Values(std::make_pair(1, 1),
+                                       std::make_pair(3, 3)),
+                                Values(TEST_SIZES_PREPROC)));
+
 INSTANTIATE_TEST_CASE_P(ColorFormats_3ch, PreprocTest,
                         Combine(PRECISIONS,
                                 Values(IE::ResizeAlgorithm::RESIZE_BILINEAR, IE::ResizeAlgorithm::RESIZE_AREA),
@@ -386,7 +396,8 @@ INSTANTIATE_TEST_CASE_P(ColorFormats_4ch, PreprocTest,
 
 INSTANTIATE_TEST_CASE_P(ColorFormat_NV12, PreprocTest,
                         Combine(Values(U8toU8),
-                                Values(IE::ResizeAlgorithm::RESIZE_BILINEAR, IE::ResizeAlgorithm::RESIZE_AREA),
+                                Values(IE::ResizeAlgorithm::RESIZE_BILINEAR, IE::ResizeAlgorithm::RESIZE_AREA,
+                                       IE::ResizeAlgorithm::RESIZE_NEAREST),
                                 Values(IE::ColorFormat::NV12),
                                 Values(IE::Layout::NCHW),
                                 Values(IE::Layout::NHWC, IE::Layout::NCHW),
@@ -417,3 +428,9 @@ INSTANTIATE_TEST_CASE_P(PrecisionConversionsPipelines, PreprocTest,
                                 Values(IE::Layout::NHWC, IE::Layout::NCHW),
                                 Values(std::make_pair(1, 1), std::make_pair(3, 3)),
                                 Values(TEST_SIZES_PREPROC)));
+
+INSTANTIATE_TEST_CASE_P(Letterbox, PreprocLetterboxTest,
+                        Combine(Values(IE::ResizeAlgorithm::RESIZE_BILINEAR, IE::ResizeAlgorithm::RESIZE_AREA,
+                                       IE::ResizeAlgorithm::RESIZE_NEAREST, IE::ResizeAlgorithm::RESIZE_BICUBIC),
+                                Values(IE::Layout::NHWC, IE::Layout::NCHW),
+                                Values(TEST_SIZES_PREPROC)));
@@ -2,12 +2,16 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+#include <string>
 #include <vector>
 #include <gtest/gtest.h>
 #include <legacy/layer_transform.hpp>
 #include "backend/gna_types.h"
 #include "frontend/model_quantizer.hpp"
 #include "frontend/layer_quantizer.hpp"
+#include "frontend/scale_factors_cache.hpp"
+#include "common_test_utils/file_utils.hpp"
 #include "gna_matcher.hpp"
 #include <ie_core.hpp>
 
@@ -456,3 +460,72 @@ TEST_F(I16QuantisationTest, SplitToConcatWith2Inputs1360NotAlignedNoFC) {
             .propagate_forward()
             .called();
 }
+
+TEST_F(I16QuantisationTest, scaleFactorsCacheHitGivesSameQuantizationAsSearch) {
+    ModelQuantizer<QuantI16> q;
+
+    auto weights = make_shared_blob<uint8_t>({ Precision::U8, {440}, C });
+    weights->allocate();
+    fillWeights(weights, {0.5f, -0.25f, 0.125f});
+
+    Core ie;
+    auto network = ie.ReadNetwork(eltwiseMulModel(), weights);
+
+    // emulates FakeQuantize ranges, the search copies them to the weights quantization of the eltwise layer
+    std::string key;
+    auto setRanges = [&key](InferenceEngine::CNNNetwork &net, bool runBeforeCopy) {
+        if (runBeforeCopy) {
+            return;
+        }
+        auto sorted = details::CNNNetSortTopologically(net);
+        for (auto &&layer : sorted) {
+            if (layer->name == "FullyConnected_1") {
+                auto quantParams = getInjectedData<QuantizedLayerParams>(layer);
+                quantParams->_dst_quant.SetLevels(65535);
+                quantParams->_dst_quant.SetMinValues({-2.f});
+                quantParams->_dst_quant.SetMaxValues({2.f});
+            }
+        }
+        // the same key ModelQuantizer uses for 2 bytes weights
+        key = ScaleFactorsCache::GetKey(sorted, {1000.f}, "I16_2");
+    };
+
+    ScaleFactorsCache cache(".");
+    auto reference = q.quantize(network, setRanges, std::vector<float>{1000.f});
+    auto stored = q.quantize(network, setRanges, std::vector<float>{1000.f}, &cache, "I16");
+    const auto cacheEntry = "gna_sf_" + key + ".blob";
+    ASSERT_TRUE(CommonTestUtils::fileExists(cacheEntry));
+    auto loaded = q.quantize(network, setRanges, std::vector<float>{1000.f}, &cache, "I16");
+    CommonTestUtils::removeFile(cacheEntry);
+
+    auto compareQuantization = [](const Quantization &expected, const Quantization &actual) {
+        EXPECT_EQ(expected.IsScaleSet(), actual.IsScaleSet());
+        EXPECT_FLOAT_EQ(expected.GetScale(), actual.GetScale());
+        EXPECT_EQ(expected.GetLevels(), actual.GetLevels());
+        EXPECT_EQ(expected.GetMinValues(), actual.GetMinValues());
+        EXPECT_EQ(expected.GetMaxValues(), actual.GetMaxValues());
+    };
+    for (auto &&net : {stored, loaded}) {
+        auto expectedLayers = details::CNNNetSortTopologically(reference);
+        auto actualLayers = details::CNNNetSortTopologically(net);
+        ASSERT_EQ(expectedLayers.size(), actualLayers.size());
+        for (size_t i = 0; i < expectedLayers.size(); i++) {
+            SCOPED_TRACE(expectedLayers[i]->name);
+            ASSERT_EQ(expectedLayers[i]->name, actualLayers[i]->name);
+            auto expectedQuant = getInjectedData<QuantizedLayerParams>(expectedLayers[i]);
+            auto actualQuant = getInjectedData<QuantizedLayerParams>(actualLayers[i]);
+            compareQuantization(expectedQuant->_src_quant, actualQuant->_src_quant);
+            compareQuantization(expectedQuant->_dst_quant, actualQuant->_dst_quant);
+            compareQuantization(expectedQuant->_weights_quant, actualQuant->_weights_quant);
+            compareQuantization(expectedQuant->_bias_quant, actualQuant->_bias_quant);
+
+            // quantized weights and biases
+            for (auto &&blob : expectedLayers[i]->blobs) {
+                auto actualBlob = actualLayers[i]->blobs.at(blob.first);
+                ASSERT_EQ(blob.second->byteSize(), actualBlob->byteSize());
+                EXPECT_EQ(0, std::memcmp(blob.second->cbuffer().as<const uint8_t *>(),
+                                         actualBlob->cbuffer().as<const uint8_t *>(), actualBlob->byteSize()));
+            }
+        }
+    }
+}
@@ -492,4 +492,10 @@ namespace ngraph
 
     NGRAPH_API
     bool replace_node_update_name(std::shared_ptr<Node> target, std::shared_ptr<Node> replacement);
+
+    /// \brief Revalidates node and infers its output types.
+    /// \return true if element type or partial shape of any node output was changed, so the
+    ///         consumers of this node have to be revalidated as well.
+    NGRAPH_API
+    bool revalidate_and_check_outputs(const std::shared_ptr<Node>& node);
 }
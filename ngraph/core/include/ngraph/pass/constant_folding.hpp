@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include "ngraph/pass/pass.hpp"
 
 namespace ngraph
@@ -36,9 +38,15 @@ namespace ngraph
         private:
             void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                     const Output<Node>& replacement);
+            /// \brief Adds consumers of all node outputs to the given set of nodes
+            void mark_consumers(const std::shared_ptr<Node>& node,
+                                std::unordered_set<std::shared_ptr<Node>>& nodes);
             /// \brief Folds pre-calculated output tensor values to constants in case lower and
             /// upper estimations are equal. Traverses graph backwards starting from the results.
-            bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f);
+            /// Consumers of folded values are added to nodes_to_revalidate.
+            bool pre_calculated_values_folding(
+                const std::shared_ptr<ngraph::Function>& f,
+                std::unordered_set<std::shared_ptr<Node>>& nodes_to_revalidate);
         };
     } // namespace pass
 } // namespace ngraph
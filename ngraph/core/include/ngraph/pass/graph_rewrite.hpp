@@ -107,6 +107,18 @@ namespace ngraph
             std::vector<std::shared_ptr<ngraph::Node>> m_new_nodes;
         };
 
+        /// \brief Profiling information collected for a single MatcherPass inside GraphRewrite
+        struct MatcherProfilingInfo
+        {
+            std::string name;
+            /// \brief Total time spent in MatcherPass::apply calls
+            size_t time_us = 0;
+            /// \brief Number of MatcherPass::apply calls
+            size_t apply_count = 0;
+            /// \brief Number of MatcherPass::apply calls that have changed the graph
+            size_t rewrite_count = 0;
+        };
+
         /// \brief GraphRewrite is a container for MatcherPasses that allows to run them on Function
         /// in
         /// efficient way
@@ -229,8 +241,29 @@ namespace ngraph
 
             void set_pass_config(const std::shared_ptr<PassConfig>& pass_config) override;
 
+            /// \brief Set flag to enable/disable worklist execution mode.
+            /// In worklist mode every successful rewrite schedules nodes created in front of
+            /// the consumers of the matched node and the consumers themselves, even if they
+            /// were visited before, so cascading rewrites are applied within a single traversal.
+            /// With shape inference enabled only nodes downstream of the rewritten ones are
+            /// revalidated.
+            /// \param new_state Value "true" enables worklist mode; "false", otherwise
+            void set_worklist_mode(bool new_state) { m_enable_worklist = new_state; }
+            /// \brief Set flag to enable/disable collecting of time spent in each registered
+            /// MatcherPass. Collected information is accumulated across run_on_function calls.
+            /// \param new_state Value "true" enables profiling; "false", otherwise
+            void set_per_matcher_profiling(bool new_state) { m_per_matcher_profiling = new_state; }
+            bool get_per_matcher_profiling() const { return m_per_matcher_profiling; }
+            /// \return Profiling information for registered MatcherPasses which were applied at
+            /// least once since last reset_matcher_profiling_info call
+            std::vector<MatcherProfilingInfo> get_matcher_profiling_info() const;
+
+            void reset_matcher_profiling_info() { m_matcher_profiling_info.clear(); }
         protected:
             bool m_enable_shape_inference = false;
+            bool m_enable_worklist = false;
+            bool m_per_matcher_profiling = false;
+            std::vector<MatcherProfilingInfo> m_matcher_profiling_info;
 
             std::vector<std::shared_ptr<ngraph::pass::MatcherPass>> m_matchers;
         };
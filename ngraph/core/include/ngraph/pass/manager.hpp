@@ -18,9 +18,11 @@
 
 #include <list>
 #include <memory>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/validate.hpp"
 
@@ -28,6 +30,24 @@ namespace ngraph
 {
     namespace pass
     {
+        /// \brief Profiling information collected for a single pass executed by pass::Manager
+        struct PassProfilingInfo
+        {
+            std::string name;
+            /// \brief Wall time spent in the pass
+            size_t time_us = 0;
+            /// \brief Number of nodes in the function before and after the pass
+            size_t nodes_before = 0;
+            size_t nodes_after = 0;
+            /// \brief Approximate function size in bytes (see Function::get_graph_size) before
+            /// and after the pass. The difference shows how much memory the pass has allocated
+            /// for new nodes and constants or released.
+            size_t graph_size_before = 0;
+            size_t graph_size_after = 0;
+            /// \brief Time spent in each MatcherPass in case if the pass is GraphRewrite
+            std::vector<MatcherProfilingInfo> matchers;
+        };
+
         class NGRAPH_API Manager
         {
         public:
@@ -72,6 +92,18 @@ namespace ngraph
             /// each registered pass
             /// \param new_state Value "true" enables Validate pass run; "false", otherwise
             void set_per_pass_validation(bool new_state) { m_per_pass_validation = new_state; }
+            /// \brief Set flag to enable/disable collecting of profiling information for each
+            /// executed pass. NGRAPH_PROFILE_PASS_ENABLE environment variable prints the same
+            /// information to the standard output independently of this flag.
+            /// Per-matcher profiling state of GraphRewrite passes is restored after each pass.
+            /// \param new_state Value "true" enables profiling; "false", otherwise
+            void set_per_pass_profiling(bool new_state) { m_profile = new_state; }
+            /// \return Profiling information for passes executed by the last run_passes call.
+            /// Information is collected only if profiling is enabled by set_per_pass_profiling.
+            const std::vector<PassProfilingInfo>& get_profiling_info() const
+            {
+                return m_profiling_info;
+            }
             /// \brief Callback is a lambda function that can be used by registered transformations.
             /// The main purpose of this callback is to provide a way for plugins to disable/enable
             /// transformations based on some conditions. In some cases plugins may want not to
@@ -125,6 +157,8 @@ namespace ngraph
             std::vector<std::shared_ptr<PassBase>> m_pass_list;
             bool m_visualize = false;
             bool m_per_pass_validation = true;
+            bool m_profile = false;
+            std::vector<PassProfilingInfo> m_profiling_info;
         };
     }
 }
@@ -942,3 +942,23 @@ bool ngraph::replace_node_update_name(std::shared_ptr<Node> target,
     copy_runtime_info(target, replacement);
     return true;
 }
+
+bool ngraph::revalidate_and_check_outputs(const std::shared_ptr<Node>& node)
+{
+    std::vector<std::pair<element::Type, PartialShape>> before;
+    before.reserve(node->get_output_size());
+    for (const auto& output : node->outputs())
+    {
+        before.emplace_back(output.get_element_type(), output.get_partial_shape());
+    }
+    node->revalidate_and_infer_types();
+    for (size_t i = 0; i < before.size(); ++i)
+    {
+        if (before[i].first != node->get_output_element_type(i) ||
+            !before[i].second.same_scheme(node->get_output_partial_shape(i)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -16,6 +16,7 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 #include <ngraph/op/constant.hpp>
+#include "ngraph/graph_util.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
 
@@ -26,13 +27,16 @@ NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
-    bool rewritten = pre_calculated_values_folding(f);
+    // Nodes which inputs were replaced by constants. Only these nodes (and their consumers in case
+    // if output types were changed) have to be revalidated.
+    unordered_set<shared_ptr<Node>> nodes_to_revalidate;
+    bool rewritten = pre_calculated_values_folding(f, nodes_to_revalidate);
 
     for (const auto& node : f->get_ordered_ops())
     {
-        if (rewritten)
+        if (nodes_to_revalidate.erase(node) && revalidate_and_check_outputs(node))
         {
-            node->validate_and_infer_types();
+            mark_consumers(node, nodes_to_revalidate);
         }
 
         OutputVector replacements(node->get_output_size());
@@ -61,6 +65,7 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
                     node_output.replace(replacement);
                     // Propagate runtime info attributes to replacement consumer nodes
                     copy_runtime_info_to_target_inputs(node, replacement);
+                    mark_consumers(replacement.get_node_shared_ptr(), nodes_to_revalidate);
 
                     rewritten = true;
                 }
@@ -92,8 +97,21 @@ void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(
     }
 }
 
+void ngraph::pass::ConstantFolding::mark_consumers(
+    const std::shared_ptr<Node>& node, std::unordered_set<std::shared_ptr<Node>>& nodes)
+{
+    for (const auto& output : node->outputs())
+    {
+        for (auto& input : output.get_target_inputs())
+        {
+            nodes.insert(input.get_node()->shared_from_this());
+        }
+    }
+}
+
 bool ngraph::pass::ConstantFolding::pre_calculated_values_folding(
-    const std::shared_ptr<ngraph::Function>& f)
+    const std::shared_ptr<ngraph::Function>& f,
+    std::unordered_set<std::shared_ptr<Node>>& nodes_to_revalidate)
 {
     deque<shared_ptr<Node>> nodes;
     set<shared_ptr<Node>> visited;
@@ -132,6 +150,7 @@ bool ngraph::pass::ConstantFolding::pre_calculated_values_folding(
                     input_value.replace(replacement);
                     // Propagate runtime info attributes to replacement consumer nodes
                     copy_runtime_info_to_target_inputs(input_node, replacement);
+                    mark_consumers(replacement, nodes_to_revalidate);
 
                     rewritten = true;
                 }
@@ -24,9 +24,11 @@
 
 #include "itt.hpp"
 #include "ngraph/env_util.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -62,11 +64,77 @@ using namespace ngraph;
 // GraphRewrite will automatically add this nodes in the beginning of execution queue.
 // If MatcherPass register more than one node make sure that this nodes are registered in
 // topological order.
+//
+// Worklist mode:
+// By default only nodes from the initial topological order and nodes registered by MatcherPasses
+// are visited. When worklist mode is enabled (\sa GraphRewrite::set_worklist_mode) every
+// successful rewrite also schedules the nodes it changed: producers that appeared in front of
+// the former consumers of the matched node (in topological order) and the consumers themselves
+// are put into the beginning of execution queue, even if they were visited before, so cascading
+// fusions are applied within a single traversal instead of re-running the whole GraphRewrite.
+// With shape inference enabled only consumers of rewritten nodes (and their users, if output
+// types have changed) are revalidated.
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::GraphRewrite, "ngraph::pass::GraphRewrite", 0);
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::MatcherPass, "ngraph::pass::MatcherPass", 0);
 
+namespace
+{
+    vector<shared_ptr<Node>> get_consumers(const shared_ptr<Node>& node)
+    {
+        vector<shared_ptr<Node>> consumers;
+        for (const auto& output : node->outputs())
+        {
+            for (const auto& input : output.get_target_inputs())
+            {
+                consumers.push_back(input.get_node()->shared_from_this());
+            }
+        }
+        return consumers;
+    }
+
+    // Walks up from the inputs of given nodes and collects producers which were not scheduled for
+    // execution yet (i.e. nodes created by the rewrite). Returned nodes are in topological order
+    // and are marked as scheduled.
+    vector<shared_ptr<Node>>
+        collect_unscheduled_producers(const vector<shared_ptr<Node>>& nodes,
+                                      unordered_set<shared_ptr<Node>>& scheduled_nodes)
+    {
+        vector<shared_ptr<Node>> result;
+        // stack of (node, visited inputs) pairs to avoid recursion on deep graphs
+        vector<pair<shared_ptr<Node>, size_t>> stack;
+        for (const auto& node : nodes)
+        {
+            for (const auto& input_value : node->input_values())
+            {
+                auto producer = input_value.get_node_shared_ptr();
+                if (!scheduled_nodes.insert(producer).second)
+                    continue;
+                stack.emplace_back(producer, 0);
+                while (!stack.empty())
+                {
+                    auto& top = stack.back();
+                    if (top.second < top.first->get_input_size())
+                    {
+                        auto parent = top.first->get_input_node_shared_ptr(top.second++);
+                        if (scheduled_nodes.insert(parent).second)
+                        {
+                            stack.emplace_back(parent, 0);
+                        }
+                    }
+                    else
+                    {
+                        result.push_back(top.first);
+                        stack.pop_back();
+                    }
+                }
+            }
+        }
+        return result;
+    }
+}
+
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "pass::GraphRewrite::run_on_function");
@@ -81,6 +149,15 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         nodes_to_run.emplace_back(node);
     }
 
+    // Nodes that were already scheduled for execution and nodes which inputs were rewired by
+    // successful rewrites. Both are used only in worklist mode.
+    unordered_set<shared_ptr<Node>> scheduled_nodes;
+    unordered_set<shared_ptr<Node>> dirty_nodes;
+    if (m_enable_worklist)
+    {
+        scheduled_nodes.insert(nodes_to_run.begin(), nodes_to_run.end());
+    }
+
     // Check that all Matchers in MatcherPasses has type bases root node
     bool all_roots_has_type = true;
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
@@ -133,11 +210,17 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // including ones triggered by parent type info.
     }
 
+    if (m_per_matcher_profiling && m_matcher_profiling_info.size() != m_matchers.size())
+    {
+        m_matcher_profiling_info.resize(m_matchers.size());
+    }
+    stopwatch matcher_timer;
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass,
-                                std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic())
@@ -149,14 +232,34 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
             return false;
         }
 
+        // Consumers are collected before applying MatcherPass because after successful rewrite
+        // they will be connected to the replacement nodes
+        vector<shared_ptr<Node>> consumers;
+        if (m_enable_worklist)
+        {
+            consumers = get_consumers(node);
+        }
+
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
+        if (m_per_matcher_profiling)
+        {
+            matcher_timer.start();
+        }
         bool status = m_pass->apply(node);
+        if (m_per_matcher_profiling)
+        {
+            matcher_timer.stop();
+            auto& info = m_matcher_profiling_info[matcher_index];
+            info.time_us += matcher_timer.get_microseconds();
+            info.apply_count++;
+            info.rewrite_count += status ? 1 : 0;
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
         const auto& new_nodes = m_pass->get_new_nodes();
-        if (!new_nodes.empty())
+        if (!m_enable_worklist)
         {
             // Need to push nodes in reverse order as we expect that nodes in new_nodes
             // vector are in topological order
@@ -164,8 +267,43 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
             {
                 nodes_to_run.emplace_front(*it);
             }
-            m_pass->clear_new_nodes();
         }
+        else
+        {
+            // In worklist mode every node changed by the rewrite is visited again, even if it
+            // was visited before: new producers of the former consumers (in topological order),
+            // then registered nodes and finally the consumers whose inputs were rewired
+            vector<shared_ptr<Node>> changed_nodes;
+            if (status)
+            {
+                dirty_nodes.insert(consumers.begin(), consumers.end());
+                changed_nodes = collect_unscheduled_producers(consumers, scheduled_nodes);
+            }
+            unordered_set<shared_ptr<Node>> enqueued(changed_nodes.begin(), changed_nodes.end());
+            for (const auto& new_node : new_nodes)
+            {
+                if (enqueued.insert(new_node).second)
+                {
+                    scheduled_nodes.insert(new_node);
+                    changed_nodes.push_back(new_node);
+                }
+            }
+            if (status)
+            {
+                for (const auto& consumer : consumers)
+                {
+                    if (enqueued.insert(consumer).second)
+                    {
+                        changed_nodes.push_back(consumer);
+                    }
+                }
+            }
+            for (auto it = changed_nodes.rbegin(); it != changed_nodes.rend(); it++)
+            {
+                nodes_to_run.emplace_front(*it);
+            }
+        }
+        m_pass->clear_new_nodes();
         return status;
     };
 
@@ -187,7 +325,16 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // Temporary keep this GraphRewrite property for backward compatibility
         if (m_enable_shape_inference)
         {
-            node->revalidate_and_infer_types();
+            if (!m_enable_worklist)
+            {
+                node->revalidate_and_infer_types();
+            }
+            else if (dirty_nodes.erase(node) && revalidate_and_check_outputs(node))
+            {
+                // output types were changed so consumers have to be revalidated too
+                const auto consumers = get_consumers(node);
+                dirty_nodes.insert(consumers.begin(), consumers.end());
+            }
         }
         // If all Matchers in MatcherPasses has type based root node then we apply efficient
         // algorithm for finding matchers
@@ -217,7 +364,7 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 
             for (size_t matcher_index : matcher_passes_to_run)
             {
-                if (run_matcher_pass(m_matchers[matcher_index], node))
+                if (run_matcher_pass(matcher_index, node))
                 {
                     rewritten = true;
                     break;
@@ -227,13 +374,13 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // Otherwise we use default algorithm that iterates over all registered matcher passes
         else
         {
-            for (auto& m_pass : m_matchers)
+            for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index)
             {
                 // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
+                if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
                     continue;
 
-                if (run_matcher_pass(m_pass, node))
+                if (run_matcher_pass(matcher_index, node))
                 {
                     rewritten = true;
                     break;
@@ -244,6 +391,19 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
     return rewritten;
 }
 
+std::vector<pass::MatcherProfilingInfo> pass::GraphRewrite::get_matcher_profiling_info() const
+{
+    std::vector<MatcherProfilingInfo> result;
+    for (size_t i = 0; i < m_matcher_profiling_info.size() && i < m_matchers.size(); ++i)
+    {
+        if (m_matcher_profiling_info[i].apply_count == 0)
+            continue;
+        result.push_back(m_matcher_profiling_info[i]);
+        result.back().name = m_matchers[i]->get_name();
+    }
+    return result;
+}
+
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                                      const graph_rewrite_callback& callback,
                                      const PassPropertyMask& property)
@@ -73,6 +73,35 @@ namespace ngraph
                 static PerfCounters counters;
                 return counters;
             }
+
+            // Enables per-matcher profiling of GraphRewrite for the time of a single pass and
+            // restores the state set by the user afterwards
+            class MatcherProfilingScope
+            {
+            public:
+                explicit MatcherProfilingScope(std::shared_ptr<GraphRewrite> graph_rewrite)
+                    : m_graph_rewrite(std::move(graph_rewrite))
+                {
+                    if (m_graph_rewrite)
+                    {
+                        m_prev_state = m_graph_rewrite->get_per_matcher_profiling();
+                        m_graph_rewrite->set_per_matcher_profiling(true);
+                        m_graph_rewrite->reset_matcher_profiling_info();
+                    }
+                }
+
+                ~MatcherProfilingScope()
+                {
+                    if (m_graph_rewrite)
+                    {
+                        m_graph_rewrite->set_per_matcher_profiling(m_prev_state);
+                    }
+                }
+
+            private:
+                std::shared_ptr<GraphRewrite> m_graph_rewrite;
+                bool m_prev_state = false;
+            };
         }
     }
 }
@@ -103,6 +132,9 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
     stopwatch overall_timer;
     overall_timer.start();
     bool function_changed = false;
+    // NGRAPH_PROFILE_PASS_ENABLE output doesn't depend on set_per_pass_profiling and vice versa
+    const bool collect_profiling = m_profile || profile_enabled;
+    m_profiling_info.clear();
     for (auto& pass : m_pass_list)
     {
         if (m_pass_config->is_disabled(pass->get_type_info()))
@@ -114,6 +146,16 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
         OV_ITT_SCOPED_TASK(itt::domains::nGraphPass_LT,
                            pass::perf_counters()[pass->get_type_info()]);
 
+        PassProfilingInfo profiling_info;
+        auto graph_rewrite = dynamic_pointer_cast<GraphRewrite>(pass);
+        MatcherProfilingScope matcher_profiling(collect_profiling ? graph_rewrite : nullptr);
+        if (collect_profiling)
+        {
+            profiling_info.name = pass->get_name();
+            profiling_info.nodes_before = func->get_ops().size();
+            profiling_info.graph_size_before = func->get_graph_size();
+        }
+
         pass_timer.start();
 
         NGRAPH_SUPPRESS_DEPRECATED_START
@@ -191,9 +233,32 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
         }
         index++;
         pass_timer.stop();
+        if (collect_profiling)
+        {
+            profiling_info.time_us = pass_timer.get_microseconds();
+            profiling_info.nodes_after = func->get_ops().size();
+            profiling_info.graph_size_after = func->get_graph_size();
+            if (graph_rewrite)
+            {
+                profiling_info.matchers = graph_rewrite->get_matcher_profiling_info();
+            }
+        }
         if (profile_enabled)
         {
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name()
+                 << " nodes: " << profiling_info.nodes_before << " -> "
+                 << profiling_info.nodes_after << " size: " << profiling_info.graph_size_before
+                 << " -> " << profiling_info.graph_size_after << " bytes\n";
+            for (const auto& matcher : profiling_info.matchers)
+            {
+                cout << setw(7) << matcher.time_us / 1000 << "ms   " << matcher.name
+                     << " applied: " << matcher.apply_count
+                     << " rewritten: " << matcher.rewrite_count << "\n";
+            }
+        }
+        if (m_profile)
+        {
+            m_profiling_info.push_back(std::move(profiling_info));
         }
     }
     if (profile_enabled)
@@ -14,10 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
 #include <functional>
 #include <numeric>
 #include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "core/graph.hpp"
 #include "core/null_node.hpp"
@@ -62,17 +65,88 @@ namespace ngraph
                 std::string domain = get_node_domain(node_proto);
                 return (domain.empty() ? "" : domain + ".") + node_proto.op_type();
             }
+
+            /// \brief      Collects names of values the node depends on. Values from the
+            ///             enclosing scope referenced by subgraph attributes (e.g. Loop or If
+            ///             bodies) are treated as node inputs as well.
+            static void collect_node_inputs(const ONNX_NAMESPACE::NodeProto& node_proto,
+                                            std::vector<std::string>& inputs)
+            {
+                inputs.insert(
+                    inputs.end(), node_proto.input().begin(), node_proto.input().end());
+                for (const auto& attribute : node_proto.attribute())
+                {
+                    if (attribute.has_g())
+                    {
+                        for (const auto& subgraph_node : attribute.g().node())
+                        {
+                            collect_node_inputs(subgraph_node, inputs);
+                        }
+                    }
+                    for (const auto& subgraph : attribute.graphs())
+                    {
+                        for (const auto& subgraph_node : subgraph.node())
+                        {
+                            collect_node_inputs(subgraph_node, inputs);
+                        }
+                    }
+                }
+            }
+
+            /// \brief      Finds nodes which contribute to the graph outputs.
+            ///
+            /// \param[in]  graph_proto  The ONNX protobuf graph representation.
+            /// \param[out] used_names   Names of all values the graph outputs depend on.
+            ///
+            /// \return     Vector of flags (one per graph node) telling if the node is used.
+            static std::vector<bool> find_used_nodes(const ONNX_NAMESPACE::GraphProto& graph_proto,
+                                                     std::unordered_set<std::string>& used_names)
+            {
+                std::unordered_map<std::string, int> producers;
+                for (int i = 0; i < graph_proto.node_size(); ++i)
+                {
+                    for (const auto& output : graph_proto.node(i).output())
+                    {
+                        producers.emplace(output, i);
+                    }
+                }
+
+                std::vector<bool> used_nodes(graph_proto.node_size(), false);
+                std::vector<std::string> names_to_visit;
+                for (const auto& output : graph_proto.output())
+                {
+                    names_to_visit.push_back(output.name());
+                }
+                while (!names_to_visit.empty())
+                {
+                    const auto name = std::move(names_to_visit.back());
+                    names_to_visit.pop_back();
+                    if (!used_names.insert(name).second)
+                    {
+                        continue;
+                    }
+                    const auto producer = producers.find(name);
+                    if (producer != producers.end() && !used_nodes[producer->second])
+                    {
+                        used_nodes[producer->second] = true;
+                        collect_node_inputs(graph_proto.node(producer->second), names_to_visit);
+                    }
+                }
+                return used_nodes;
+            }
         } // namespace detail
 
         Graph::Graph(const ONNX_NAMESPACE::GraphProto& graph_proto, Model& model)
             : Graph(graph_proto, model, std::unique_ptr<GraphCache>(new GraphCache()))
         {
-            // Remove dangling Parameters
+            // Remove dangling Parameters. Graph inputs consumed only by unused nodes are
+            // kept as they are still inputs of the model.
             for (auto param_it = m_parameters.begin(); param_it != m_parameters.end();)
             {
-                if ((*param_it)->get_output_target_inputs(0).size() == 0)
+                const auto& name = (*param_it)->get_friendly_name();
+                if ((*param_it)->get_output_target_inputs(0).size() == 0 &&
+                    m_unused_nodes_inputs.count(name) == 0)
                 {
-                    const auto& name = (*param_it)->get_friendly_name();
                     auto out_it = std::find_if(
                         m_outputs.begin(), m_outputs.end(), [&name](const ValueInfo& info) {
                             return info.get_name() == name;
@@ -95,13 +169,26 @@ namespace ngraph
             , m_model{&model}
             , m_cache{std::move(cache)}
         {
+            // Nodes which don't contribute to the graph outputs are not converted at all. This
+            // also applies to subgraphs: bodies of unused Loop or If nodes are never created.
+            std::unordered_set<std::string> used_names;
+            const std::vector<bool> used_nodes = detail::find_used_nodes(graph_proto, used_names);
+
             std::map<std::string, Tensor> initializers;
+            const auto& initializer_tensors = m_graph_proto->initializer();
+
             // Process all initializers in the graph
-            for (const auto& initializer_tensor : m_graph_proto->initializer())
+            for (const auto& initializer_tensor : initializer_tensors)
             {
                 if (initializer_tensor.has_name())
                 {
                     Tensor tensor = Tensor{initializer_tensor};
+                    if (used_names.count(initializer_tensor.name()) == 0)
+                    {
+                        // Constant for unused initializer is created only if it's a graph input
+                        initializers.emplace(initializer_tensor.name(), tensor);
+                        continue;
+                    }
                     std::shared_ptr<default_opset::Constant> ng_constant;
                     // For each initializer create a Constant node and store it in cache
                     try
@@ -157,12 +244,14 @@ namespace ngraph
                 m_outputs.emplace_back(output);
             }
 
-            // Verify that ONNX graph contains only nodes of available operator types
+            // Verify that ONNX graph contains only nodes of available operator types. Unused
+            // nodes are not converted, so their operator types don't have to be supported.
             std::map<std::string, std::reference_wrapper<const ONNX_NAMESPACE::NodeProto>>
                 unknown_operators;
-            for (const auto& node_proto : m_graph_proto->node())
+            for (int i = 0; i < m_graph_proto->node_size(); ++i)
             {
-                if (!m_model->is_operator_available(node_proto))
+                const auto& node_proto = m_graph_proto->node(i);
+                if (used_nodes[i] && !m_model->is_operator_available(node_proto))
                 {
                     unknown_operators.emplace(detail::get_op_domain_and_name(node_proto),
                                               node_proto);
@@ -191,8 +280,18 @@ namespace ngraph
                          detail::to_string(unknown_operators));
 
             // Process ONNX graph nodes, convert to nGraph nodes
-            for (const auto& node_proto : m_graph_proto->node())
+            for (int i = 0; i < m_graph_proto->node_size(); ++i)
             {
+                const auto& node_proto = m_graph_proto->node(i);
+                if (!used_nodes[i])
+                {
+                    // values referenced only from bodies of unused subgraphs are collected too
+                    std::vector<std::string> unused_node_inputs;
+                    detail::collect_node_inputs(node_proto, unused_node_inputs);
+                    m_unused_nodes_inputs.insert(unused_node_inputs.begin(),
+                                                 unused_node_inputs.end());
+                    continue;
+                }
                 m_nodes.emplace_back(node_proto, *this);
                 const Node& node{m_nodes.back()};
 
@@ -200,9 +299,10 @@ namespace ngraph
                 // Iterate over the number of outputs for given node in graph.
                 // Some of them may be optional and trimmed. See:
                 // https://github.com/onnx/onnx/blob/master/docs/IR.md#optional-inputs-and-outputs
-                for (std::size_t i{0}; i < node.get_outputs_size(); ++i)
+                for (std::size_t output_idx{0}; output_idx < node.get_outputs_size(); ++output_idx)
                 {
-                    m_cache->emplace_node(node.output(i), std::move(ng_nodes.at(i)));
+                    m_cache->emplace_node(node.output(output_idx),
+                                          std::move(ng_nodes.at(output_idx)));
                 }
             }
         }
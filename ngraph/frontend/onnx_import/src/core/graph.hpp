@@ -19,6 +19,7 @@
 #include <memory>
 #include <onnx/onnx_pb.h>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "core/graph_cache.hpp"
@@ -75,6 +76,9 @@ namespace ngraph
             std::vector<ValueInfo> m_inputs;
             std::vector<ValueInfo> m_outputs;
             Model* m_model;
+            /// \brief Inputs of nodes which were skipped as they don't contribute to the graph
+            ///        outputs
+            std::unordered_set<std::string> m_unused_nodes_inputs;
         };
 
         /// \brief      Representation of ONNX subgraph. It is used for example by ONNX Loop op.
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "utils/common.hpp"
@@ -131,14 +132,22 @@ namespace ngraph
                         }
 
                         template <typename T>
-                        inline std::vector<T> __get_raw_data(const std::string& raw_data,
+                        inline std::vector<T> __get_raw_data(const char* raw_data,
+                                                             size_t raw_data_size,
                                                              int onnx_data_type)
                         {
-                            auto it = reinterpret_cast<const T*>(raw_data.data());
+                            auto it = reinterpret_cast<const T*>(raw_data);
                             return std::vector<T>(
                                 it,
-                                it +
-                                    (raw_data.size() / common::get_onnx_data_size(onnx_data_type)));
+                                it + (raw_data_size / common::get_onnx_data_size(onnx_data_type)));
+                        }
+
+                        template <typename T>
+                        inline std::vector<T> __get_raw_data(const std::string& raw_data,
+                                                             int onnx_data_type)
+                        {
+                            return __get_raw_data<T>(
+                                raw_data.data(), raw_data.size(), onnx_data_type);
                         }
 
                         template <typename T>
@@ -148,7 +157,8 @@ namespace ngraph
                             const auto tensor_external_data = TensorExternalData(tensor);
                             const auto raw_data = tensor_external_data.load_external_data();
 
-                            return detail::__get_raw_data<T>(raw_data, tensor.data_type());
+                            return detail::__get_raw_data<T>(
+                                raw_data->get_ptr<char>(), raw_data->size(), tensor.data_type());
                         }
 
                         bool has_tensor_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
@@ -580,8 +590,36 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                if (m_tensor_proto->has_segment())
+                {
+                    throw error::tensor::segments_unsupported{};
+                }
+                std::shared_ptr<ngraph::op::Constant> constant;
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    // the file is read once, data of unexpected size is converted element-wise
+                    // from the same buffer so the Constant reports the mismatch
+                    const auto buffer = TensorExternalData(*m_tensor_proto).load_external_data();
+                    constant = make_ng_constant_from_buffer(type, buffer);
+                    if (!constant)
+                    {
+                        constant = std::make_shared<ngraph::op::Constant>(
+                            type,
+                            m_shape,
+                            detail::tensor::detail::__get_raw_data<T>(buffer->get_ptr<char>(),
+                                                                      buffer->size(),
+                                                                      m_tensor_proto->data_type()));
+                    }
+                }
+                else
+                {
+                    constant = make_ng_constant_from_raw_data(type);
+                    if (!constant)
+                    {
+                        constant =
+                            std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                    }
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -589,6 +627,41 @@ namespace ngraph
                 return constant;
             }
 
+            /// \brief Creates Constant which shares the buffer with loaded external data.
+            /// \return nullptr if buffer size doesn't match the tensor shape; in this case values
+            /// have to be converted element-wise.
+            std::shared_ptr<ngraph::op::Constant> make_ng_constant_from_buffer(
+                const element::Type& type,
+                const std::shared_ptr<runtime::AlignedBuffer>& buffer) const
+            {
+                const size_t expected_size = shape_size(m_shape) * type.size();
+                if (expected_size == 0 || buffer->size() != expected_size)
+                {
+                    return nullptr;
+                }
+                using SharedBuffer = runtime::SharedBuffer<std::shared_ptr<runtime::AlignedBuffer>>;
+                auto shared_buffer =
+                    std::make_shared<SharedBuffer>(buffer->get_ptr<char>(), buffer->size(), buffer);
+                return std::make_shared<ngraph::op::Constant>(type, m_shape, shared_buffer);
+            }
+
+            /// \brief Creates Constant directly from binary tensor data without intermediate
+            /// std::vector copy and per-element conversion.
+            /// \return nullptr if tensor values are not stored as binary data or data size doesn't
+            /// match the tensor shape; in this case values have to be converted element-wise.
+            std::shared_ptr<ngraph::op::Constant>
+                make_ng_constant_from_raw_data(const element::Type& type) const
+            {
+                const size_t expected_size = shape_size(m_shape) * type.size();
+                if (expected_size != 0 && m_tensor_proto->has_raw_data() &&
+                    m_tensor_proto->raw_data().size() == expected_size)
+                {
+                    return std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, m_tensor_proto->raw_data().data());
+                }
+                return nullptr;
+            }
+
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
             Shape m_shape;
         };
@@ -52,6 +52,13 @@ namespace ngraph
                                    external_data.to_string()}
                 {
                 }
+
+                invalid_external_data(const onnx_import::detail::TensorExternalData& external_data,
+                                      const std::string& reason)
+                    : ngraph_error{std::string{"invalid external data: "} +
+                                   external_data.to_string() + ": " + reason}
+                {
+                }
             };
 
         } // namespace  error
@@ -34,16 +34,17 @@ namespace ngraph
                 {
                     if (entry.key() == "location")
                         m_data_location = entry.value();
+                    // external data files may exceed 2 GB so offsets are parsed as 64-bit
                     if (entry.key() == "offset")
-                        m_offset = std::stoi(entry.value());
+                        m_offset = std::stoull(entry.value());
                     if (entry.key() == "length")
-                        m_data_lenght = std::stoi(entry.value());
+                        m_data_lenght = std::stoull(entry.value());
                     if (entry.key() == "checksum")
-                        m_sha1_digest = std::stoi(entry.value());
+                        m_sha1_digest = std::stoull(entry.value());
                 }
             }
 
-            std::string TensorExternalData::load_external_data() const
+            std::shared_ptr<runtime::AlignedBuffer> TensorExternalData::load_external_data() const
             {
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
                 std::wstring path = file_util::multi_byte_char_to_wstring(m_data_location.c_str());
@@ -55,11 +56,21 @@ namespace ngraph
                 if (external_data_stream.fail())
                     throw error::invalid_external_data{*this};
 
+                // offset and length are validated before the buffer is allocated, otherwise
+                // a length computed past the end of file would be a huge allocation request
+                const uint64_t file_size = static_cast<uint64_t>(external_data_stream.tellg());
+                if (m_offset > file_size)
+                    throw error::invalid_external_data{
+                        *this, "offset exceeds file size " + std::to_string(file_size)};
+                if (m_data_lenght > file_size - m_offset)
+                    throw error::invalid_external_data{
+                        *this, "data ends beyond file size " + std::to_string(file_size)};
+
                 std::streamsize read_data_lenght;
                 if (m_data_lenght == 0) // read entire file
-                    read_data_lenght = external_data_stream.tellg();
+                    read_data_lenght = static_cast<std::streamsize>(file_size - m_offset);
                 else
-                    read_data_lenght = m_data_lenght;
+                    read_data_lenght = static_cast<std::streamsize>(m_data_lenght);
 
                 const auto page_size = 4096;
                 if (m_offset != 0 && m_offset % page_size != 0)
@@ -76,9 +87,12 @@ namespace ngraph
                     NGRAPH_WARN << "SHA1 checksum is not supported";
                 }
 
-                std::string read_data;
-                read_data.resize(read_data_lenght);
-                external_data_stream.read(&read_data[0], read_data_lenght);
+                // data is read directly into the buffer that will back the Constant
+                auto read_data =
+                    std::make_shared<runtime::AlignedBuffer>(static_cast<size_t>(read_data_lenght));
+                external_data_stream.read(read_data->get_ptr<char>(), read_data_lenght);
+                if (external_data_stream.gcount() != read_data_lenght)
+                    throw error::invalid_external_data{*this};
                 external_data_stream.close();
 
                 return read_data;
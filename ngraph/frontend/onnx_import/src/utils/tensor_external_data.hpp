@@ -16,8 +16,12 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/aligned_buffer.hpp"
+
 namespace ngraph
 {
     namespace onnx_import
@@ -36,8 +40,9 @@ namespace ngraph
                 /// \note       If reading data from external files fails,
                 ///             the invalid_external_data exception is thrown.
                 ///
-                /// \return     External binary data loaded into a std::string
-                std::string load_external_data() const;
+                /// \return     External binary data loaded into an aligned buffer which can be
+                ///             shared with nGraph Constant without copying
+                std::shared_ptr<runtime::AlignedBuffer> load_external_data() const;
 
                 /// \brief      Represets parameter of external data as string
                 ///
@@ -46,9 +51,9 @@ namespace ngraph
 
             private:
                 std::string m_data_location{};
-                int m_offset = 0;
-                int m_data_lenght = 0;
-                int m_sha1_digest = 0;
+                uint64_t m_offset = 0;
+                uint64_t m_data_lenght = 0;
+                uint64_t m_sha1_digest = 0;
             };
         }
     }
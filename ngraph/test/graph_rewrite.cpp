@@ -6,6 +6,7 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <util/test_tools.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
@@ -387,3 +388,156 @@ TEST(PassConfigTest, Test1)
         ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
     }
 }
+
+class ReluToTanhTestPass : public ngraph::pass::MatcherPass
+{
+public:
+    ReluToTanhTestPass()
+        : MatcherPass()
+    {
+        auto relu = ngraph::pattern::wrap_type<opset3::Relu>();
+        ngraph::graph_rewrite_callback callback = [](pattern::Matcher& m) {
+            auto tanh = std::make_shared<ngraph::opset3::Tanh>(m.get_match_root()->input_value(0));
+            ngraph::replace_node(m.get_match_root(), tanh);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(relu, "ReluToTanh");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, WorklistModeDisabled)
+{
+    auto f = get_function();
+
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.add_matcher<ReluToTanhTestPass>();
+    anchor.run_on_function(f);
+
+    // Relu created by TypeBasedTestPass is not registered so it is not visited
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 0);
+}
+
+TEST(GraphRewriteTest, WorklistModeEnabled)
+{
+    auto f = get_function();
+
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.add_matcher<ReluToTanhTestPass>();
+    anchor.set_worklist_mode(true);
+    anchor.run_on_function(f);
+
+    // Relu created by TypeBasedTestPass is scheduled as affected node and replaced with Tanh
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
+}
+
+TEST(GraphRewriteTest, PerMatcherProfiling)
+{
+    auto f = get_function();
+
+    pass::Manager manager;
+    auto anchor = manager.register_pass<Anchor>();
+    anchor->add_matcher<TypeBasedTestPass>();
+    anchor->add_matcher<ReluToTanhTestPass>();
+    manager.get_pass_config()->set_callback(get_callback());
+    manager.set_per_pass_profiling(true);
+    manager.run_passes(f);
+
+    const auto& profiling_info = manager.get_profiling_info();
+    ASSERT_FALSE(profiling_info.empty());
+    // Only TypeBasedTestPass was applied to Divide node and replaced it with Relu
+    const auto& matchers = profiling_info.front().matchers;
+    ASSERT_EQ(matchers.size(), 1);
+    EXPECT_EQ(matchers[0].apply_count, 1);
+    EXPECT_EQ(matchers[0].rewrite_count, 1);
+    // per-matcher profiling is enabled by the manager only while the pass is running
+    EXPECT_FALSE(anchor->get_per_matcher_profiling());
+}
+
+class InsertReluBeforeAbsTestPass : public ngraph::pass::MatcherPass
+{
+public:
+    InsertReluBeforeAbsTestPass()
+        : MatcherPass()
+    {
+        auto abs = ngraph::pattern::wrap_type<opset3::Abs>(
+            {ngraph::pattern::wrap_type<opset3::Parameter>()});
+        auto neg = ngraph::pattern::wrap_type<opset3::Negative>({abs});
+        ngraph::graph_rewrite_callback callback = [this](pattern::Matcher& m) {
+            auto abs_node = m.get_match_root()->get_input_node_shared_ptr(0);
+            auto relu = register_new_node<ngraph::opset3::Relu>(abs_node->input_value(0));
+            abs_node->input(0).replace_source_output(relu);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(neg, "InsertReluBeforeAbs");
+        this->register_matcher(m, callback);
+    }
+};
+
+class RemoveAbsAfterTanhTestPass : public ngraph::pass::MatcherPass
+{
+public:
+    RemoveAbsAfterTanhTestPass()
+        : MatcherPass()
+    {
+        auto abs =
+            ngraph::pattern::wrap_type<opset3::Abs>({ngraph::pattern::wrap_type<opset3::Tanh>()});
+        ngraph::graph_rewrite_callback callback = [](pattern::Matcher& m) {
+            auto abs_node = m.get_match_root();
+            ngraph::replace_node(abs_node, abs_node->get_input_node_shared_ptr(0));
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(abs, "RemoveAbsAfterTanh");
+        this->register_matcher(m, callback);
+    }
+};
+
+std::shared_ptr<Function> get_abs_neg_function()
+{
+    auto data =
+        std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{3, 1, 2});
+    auto abs = std::make_shared<ngraph::opset3::Abs>(data);
+    auto neg = std::make_shared<ngraph::opset3::Negative>(abs);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{neg},
+                                              ngraph::ParameterVector{data});
+}
+
+TEST(GraphRewriteTest, WorklistModeDisabledChangedConsumer)
+{
+    auto f = get_abs_neg_function();
+
+    Anchor anchor;
+    anchor.add_matcher<InsertReluBeforeAbsTestPass>();
+    anchor.add_matcher<ReluToTanhTestPass>();
+    anchor.add_matcher<RemoveAbsAfterTanhTestPass>();
+    anchor.run_on_function(f);
+
+    // Abs was visited before its input was replaced with Tanh
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
+    ASSERT_EQ(count_ops_of_type<opset3::Abs>(f), 1);
+}
+
+TEST(GraphRewriteTest, WorklistModeEnabledChangedConsumer)
+{
+    auto f = get_abs_neg_function();
+
+    Anchor anchor;
+    anchor.add_matcher<InsertReluBeforeAbsTestPass>();
+    anchor.add_matcher<ReluToTanhTestPass>();
+    anchor.add_matcher<RemoveAbsAfterTanhTestPass>();
+    anchor.set_worklist_mode(true);
+    anchor.run_on_function(f);
+
+    // Abs is visited again as a consumer changed by Relu -> Tanh rewrite
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
+    ASSERT_EQ(count_ops_of_type<opset3::Abs>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Negative>(f), 1);
+}
@@ -3803,6 +3803,41 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_model_dangling_parameter)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_unused_branch)
+{
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/unused_branch.prototxt"));
+
+    // nodes which don't contribute to the outputs are not converted, but the graph input
+    // consumed by them is still a parameter of the function
+    ASSERT_EQ(function->get_parameters().size(), 2);
+    EXPECT_TRUE(function->get_parameters().at(1)->get_output_target_inputs(0).empty());
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<float>({-1.0f, 2.0f, -3.0f});
+    test_case.add_input<float>({1.0f, 1.0f, 1.0f});
+    test_case.add_expected_output<float>(Shape{3}, {1.0f, 2.0f, 3.0f});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_unused_subgraph_branch)
+{
+    // operator type of an unused node doesn't have to be supported
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/unused_subgraph_branch.prototxt"));
+
+    // graph input referenced only from the body of an unused Loop is kept as a parameter
+    ASSERT_EQ(function->get_parameters().size(), 2);
+    EXPECT_EQ(function->get_parameters().at(1)->get_friendly_name(), "Z");
+    EXPECT_TRUE(function->get_parameters().at(1)->get_output_target_inputs(0).empty());
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<float>({-1.0f, 2.0f, -3.0f});
+    test_case.add_input<float>({1.0f, 1.0f, 1.0f});
+    test_case.add_expected_output<float>(Shape{3}, {1.0f, 2.0f, 3.0f});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_clip_inbounds)
 {
     auto function = onnx_import::import_onnx_model(
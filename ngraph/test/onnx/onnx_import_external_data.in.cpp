@@ -122,6 +122,27 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_offset_out_of_file)
+{
+    try
+    {
+        auto function = onnx_import::import_onnx_model(file_util::path_join(
+            SERIALIZED_ZOO, "onnx/external_data/external_data_offset_out_of_file.prototxt"));
+        FAIL() << "Offset beyond the end of external data file not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_PRED_FORMAT2(testing::IsSubstring,
+                            std::string("tensor.data, offset: 4096, data_lenght: 0, "
+                                        "sha1_digest: 0): offset exceeds file size 16"),
+                            error.what());
+    }
+    catch (...)
+    {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_up_dir_path)
 {
     try
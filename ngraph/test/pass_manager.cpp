@@ -54,3 +54,30 @@ namespace
         bool run_on_function(std::shared_ptr<ngraph::Function> /* f */) override { return false; }
     };
 }
+
+TEST(pass_manager, per_pass_profiling)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.set_per_pass_profiling(true);
+
+    auto graph = make_test_graph();
+    const auto node_count = graph->get_ops().size();
+    pass_manager.run_passes(graph);
+
+    // DummyPass and Validate pass registered after it
+    const auto& profiling_info = pass_manager.get_profiling_info();
+    ASSERT_EQ(profiling_info.size(), 2);
+    for (const auto& info : profiling_info)
+    {
+        EXPECT_FALSE(info.name.empty());
+        EXPECT_EQ(info.nodes_before, node_count);
+        EXPECT_EQ(info.nodes_after, node_count);
+        EXPECT_EQ(info.graph_size_before, info.graph_size_after);
+        EXPECT_TRUE(info.matchers.empty());
+    }
+
+    pass_manager.set_per_pass_profiling(false);
+    pass_manager.run_passes(graph);
+    EXPECT_TRUE(pass_manager.get_profiling_info().empty());
+}